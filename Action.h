@@ -0,0 +1,50 @@
+#ifndef GAME_PROJECT_ACTION_H
+#define GAME_PROJECT_ACTION_H
+#include "Auxiliaries.h"
+
+namespace mtm
+{
+    /**
+    * enum ActionType:
+    *      the actions a character on the board can perform.
+    */
+    enum ActionType { MOVE_ACTION, ATTACK_ACTION, RELOAD_ACTION };
+
+    /**
+    * enum ActionStatus:
+    *      the result of an action. every failure matches the exception that the throwing API raises for it.
+    */
+    enum ActionStatus {
+        ACTION_SUCCESS,
+        ACTION_ILLEGAL_CELL,
+        ACTION_CELL_EMPTY,
+        ACTION_MOVE_TOO_FAR,
+        ACTION_CELL_OCCUPIED,
+        ACTION_OUT_OF_RANGE,
+        ACTION_OUT_OF_AMMO,
+        ACTION_ILLEGAL_TARGET
+    };
+
+    /**
+    * struct Action:
+    *      a single action of a character on the board.
+    *      a reload action uses only the src coordinates.
+    */
+    struct Action {
+        ActionType type;
+        GridPoint src_coordinates;
+        GridPoint dst_coordinates;
+
+        /**
+        * constructor of the action that receives 3 parameters.
+        * @param type : the type of the action.
+        * @param src_coordinates : the coordinates of the character that performs the action.
+        * @param dst_coordinates : the destination of a move or the target of an attack.
+        */
+        Action(ActionType type, const GridPoint& src_coordinates, const GridPoint& dst_coordinates) :
+                type(type), src_coordinates(src_coordinates), dst_coordinates(dst_coordinates)
+        {}
+    };
+}
+
+#endif //GAME_PROJECT_ACTION_H
@@ -0,0 +1,277 @@
+#include "ActionJournal.h"
+#include "GameSnapshot.h"
+#include "LittleEndian.h"
+#include <cstring>
+
+namespace mtm
+{
+    using std::vector;
+    using std::shared_ptr;
+
+    const char ActionJournal::MAGIC[4] = {'R', 'P', 'G', 'J'};
+    const uint32_t ActionJournal::FORMAT_VERSION = 1;
+    const size_t ActionJournal::HEADER_SIZE = 8;
+    const size_t ActionJournal::CHECKPOINT_HEADER_SIZE = 17;
+    const size_t ActionJournal::ADD_CHARACTER_ENTRY_SIZE = 31;
+    const size_t ActionJournal::TWO_CELLS_ENTRY_SIZE = 17;
+    const size_t ActionJournal::ONE_CELL_ENTRY_SIZE = 9;
+
+    ActionJournal::ActionJournal(const Game& initial_game, uint64_t checkpoint_interval) :
+            data(MAGIC, MAGIC + sizeof(MAGIC)), checkpoints(), num_of_actions(0),
+            checkpoint_interval(checkpoint_interval), is_trusted(true)
+    {
+        LittleEndian::writeUint32(data, FORMAT_VERSION);
+        writeCheckpoint(initial_game);
+    }
+
+    ActionJournal::ActionJournal(const char* data, size_t size) :
+            data(data, data + size), checkpoints(), num_of_actions(0), checkpoint_interval(0), is_trusted(false)
+    {
+        if (size < HEADER_SIZE || memcmp(data, MAGIC, sizeof(MAGIC)) != 0 ||
+            LittleEndian::readUint32(data + 4) != FORMAT_VERSION)
+        {
+            throw InvalidSnapshot();
+        }
+        size_t position = HEADER_SIZE;
+        while (position < size)
+        {
+            size_t entry_size = 0;
+            switch (data[position]) {
+                case ADD_CHARACTER_ENTRY :
+                    entry_size = ADD_CHARACTER_ENTRY_SIZE;
+                    if (entry_size <= size - position && !isAddedCharacterValid(data + position))
+                    {
+                        throw InvalidSnapshot();
+                    }
+                    break;
+                case MOVE_ENTRY :
+                case ATTACK_ENTRY :
+                    entry_size = TWO_CELLS_ENTRY_SIZE;
+                    break;
+                case RELOAD_ENTRY :
+                    entry_size = ONE_CELL_ENTRY_SIZE;
+                    break;
+                case CHECKPOINT_ENTRY :
+                {
+                    if (size - position < CHECKPOINT_HEADER_SIZE ||
+                        LittleEndian::readUint64(data + position + 1) != num_of_actions)
+                    {
+                        throw InvalidSnapshot();
+                    }
+                    uint64_t snapshot_size = LittleEndian::readUint64(data + position + 9);
+                    if (snapshot_size > size - position - CHECKPOINT_HEADER_SIZE)
+                    {
+                        throw InvalidSnapshot();
+                    }
+                    entry_size = CHECKPOINT_HEADER_SIZE + static_cast<size_t>(snapshot_size);
+                    break;
+                }
+                default :
+                    throw InvalidSnapshot();
+            }
+            if (entry_size > size - position || (checkpoints.empty() && data[position] != CHECKPOINT_ENTRY))
+            {
+                throw InvalidSnapshot();
+            }
+            if (data[position] == CHECKPOINT_ENTRY)
+            {
+                Checkpoint checkpoint = {num_of_actions, position + CHECKPOINT_HEADER_SIZE,
+                                         entry_size - CHECKPOINT_HEADER_SIZE};
+                checkpoints.push_back(checkpoint);
+            }
+            else
+            {
+                num_of_actions++;
+            }
+            position += entry_size;
+        }
+        if (checkpoints.empty())
+        {
+            throw InvalidSnapshot();
+        }
+    }
+
+    bool ActionJournal::isAddedCharacterValid(const char* entry) {
+        unsigned char type = static_cast<unsigned char>(entry[9]);
+        unsigned char team = static_cast<unsigned char>(entry[10]);
+        units_t health = static_cast<units_t>(LittleEndian::readUint32(entry + 11));
+        units_t ammo = static_cast<units_t>(LittleEndian::readUint32(entry + 15));
+        units_t range = static_cast<units_t>(LittleEndian::readUint32(entry + 19));
+        units_t power = static_cast<units_t>(LittleEndian::readUint32(entry + 23));
+        int successful_strikes_counter = static_cast<int>(LittleEndian::readUint32(entry + 27));
+        return type <= SNIPER && team <= CROSSFITTERS && health > 0 && ammo >= 0 && range >= 0 && power >= 0 &&
+               successful_strikes_counter >= 0;
+    }
+
+    void ActionJournal::writeCoordinates(const GridPoint& coordinates) {
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(coordinates.row));
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(coordinates.col));
+    }
+
+    GridPoint ActionJournal::readCoordinates(const char* position) {
+        return GridPoint(static_cast<int>(LittleEndian::readUint32(position)),
+                         static_cast<int>(LittleEndian::readUint32(position + 4)));
+    }
+
+    void ActionJournal::writeCheckpoint(const Game& game) {
+        data.push_back(static_cast<char>(CHECKPOINT_ENTRY));
+        LittleEndian::writeUint64(data, num_of_actions);
+        size_t size_offset = data.size();
+        LittleEndian::writeUint64(data, 0);
+        size_t snapshot_offset = data.size();
+        GameSnapshot::serialize(game, data);
+        size_t snapshot_size = data.size() - snapshot_offset;
+        LittleEndian::overwriteUint64(data.data() + size_offset, snapshot_size);
+        Checkpoint checkpoint = {num_of_actions, snapshot_offset, snapshot_size};
+        checkpoints.push_back(checkpoint);
+    }
+
+    void ActionJournal::finishAction(const Game& game) {
+        num_of_actions++;
+        if (checkpoint_interval != 0 && num_of_actions % checkpoint_interval == 0)
+        {
+            writeCheckpoint(game);
+        }
+    }
+
+    void ActionJournal::recordAddCharacter(const Game& game, const GridPoint& coordinates, const Character& character) {
+        data.push_back(static_cast<char>(ADD_CHARACTER_ENTRY));
+        writeCoordinates(coordinates);
+        data.push_back(static_cast<char>(character.getCharacterType()));
+        data.push_back(static_cast<char>(character.getCharacterTeam()));
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterHealthPoints()));
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterAmmo()));
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterRange()));
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterPower()));
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getSuccessfulStrikesCounter()));
+        finishAction(game);
+    }
+
+    void ActionJournal::recordMove(const Game& game, const GridPoint& src_coordinates,
+                                   const GridPoint& dst_coordinates) {
+        data.push_back(static_cast<char>(MOVE_ENTRY));
+        writeCoordinates(src_coordinates);
+        writeCoordinates(dst_coordinates);
+        finishAction(game);
+    }
+
+    void ActionJournal::recordAttack(const Game& game, const GridPoint& src_coordinates,
+                                     const GridPoint& dst_coordinates) {
+        data.push_back(static_cast<char>(ATTACK_ENTRY));
+        writeCoordinates(src_coordinates);
+        writeCoordinates(dst_coordinates);
+        finishAction(game);
+    }
+
+    void ActionJournal::recordReload(const Game& game, const GridPoint& coordinates) {
+        data.push_back(static_cast<char>(RELOAD_ENTRY));
+        writeCoordinates(coordinates);
+        finishAction(game);
+    }
+
+    void ActionJournal::recordCheckpoint(const Game& game) {
+        writeCheckpoint(game);
+    }
+
+    uint64_t ActionJournal::getNumOfActions() const {
+        return num_of_actions;
+    }
+
+    const vector<char>& ActionJournal::getData() const {
+        return data;
+    }
+
+    bool ActionJournal::isTrusted() const {
+        return is_trusted;
+    }
+
+    size_t ActionJournal::applyEntry(Game& game, size_t position, bool check_action) const {
+        const char* entry = data.data() + position;
+        switch (entry[0]) {
+            case ADD_CHARACTER_ENTRY :
+            {
+                GridPoint coordinates = readCoordinates(entry + 1);
+                if (check_action && (game.areCoordinatesIllegal(coordinates) || !game.isCellEmpty(coordinates)))
+                {
+                    throw InvalidSnapshot();
+                }
+                CharacterType type = static_cast<CharacterType>(entry[9]);
+                shared_ptr<Character> character = Game::makeCharacter(
+                        type, static_cast<Team>(entry[10]),
+                        static_cast<units_t>(LittleEndian::readUint32(entry + 11)),
+                        static_cast<units_t>(LittleEndian::readUint32(entry + 15)),
+                        static_cast<units_t>(LittleEndian::readUint32(entry + 19)),
+                        static_cast<units_t>(LittleEndian::readUint32(entry + 23)));
+                character->setSuccessfulStrikesCounter(static_cast<int>(LittleEndian::readUint32(entry + 27)));
+                game.applyAddCharacter(coordinates, character);
+                return position + ADD_CHARACTER_ENTRY_SIZE;
+            }
+            case MOVE_ENTRY :
+            {
+                GridPoint src_coordinates = readCoordinates(entry + 1);
+                GridPoint dst_coordinates = readCoordinates(entry + 9);
+                if (check_action && game.checkMove(src_coordinates, dst_coordinates) != ACTION_SUCCESS)
+                {
+                    throw InvalidSnapshot();
+                }
+                game.applyMove(src_coordinates, dst_coordinates);
+                return position + TWO_CELLS_ENTRY_SIZE;
+            }
+            case ATTACK_ENTRY :
+            {
+                GridPoint src_coordinates = readCoordinates(entry + 1);
+                GridPoint dst_coordinates = readCoordinates(entry + 9);
+                if (!check_action)
+                {
+                    game.dispatchAttack(src_coordinates, dst_coordinates, false);
+                }
+                else if (game.areCoordinatesIllegal(src_coordinates) || game.areCoordinatesIllegal(dst_coordinates) ||
+                         game.isCellEmpty(src_coordinates) ||
+                         game.dispatchAttack(src_coordinates, dst_coordinates, true) != ACTION_SUCCESS)
+                {
+                    throw InvalidSnapshot();
+                }
+                return position + TWO_CELLS_ENTRY_SIZE;
+            }
+            case RELOAD_ENTRY :
+            {
+                GridPoint coordinates = readCoordinates(entry + 1);
+                if (check_action && (game.areCoordinatesIllegal(coordinates) || game.isCellEmpty(coordinates)))
+                {
+                    throw InvalidSnapshot();
+                }
+                game.applyReload(coordinates);
+                return position + ONE_CELL_ENTRY_SIZE;
+            }
+            default :
+                return position + CHECKPOINT_HEADER_SIZE + LittleEndian::readUint64(entry + 9);
+        }
+    }
+
+    Game ActionJournal::replay() const {
+        return replay(num_of_actions);
+    }
+
+    Game ActionJournal::replay(uint64_t num_of_actions) const {
+        if (num_of_actions > this->num_of_actions)
+        {
+            throw IllegalArgument();
+        }
+        vector<Checkpoint>::const_iterator checkpoint = checkpoints.begin();
+        while (checkpoint + 1 != checkpoints.end() && (checkpoint + 1)->num_of_actions <= num_of_actions)
+        {
+            ++checkpoint;
+        }
+        Game game = GameSnapshot::deserialize(data.data() + checkpoint->snapshot_offset, checkpoint->snapshot_size);
+        size_t position = checkpoint->snapshot_offset + checkpoint->snapshot_size;
+        for (uint64_t replayed_actions = checkpoint->num_of_actions; replayed_actions < num_of_actions;)
+        {
+            if (data[position] != CHECKPOINT_ENTRY)
+            {
+                replayed_actions++;
+            }
+            position = applyEntry(game, position, !is_trusted);
+        }
+        return game;
+    }
+}
@@ -0,0 +1,184 @@
+#ifndef GAME_PROJECT_ACTIONJOURNAL_H
+#define GAME_PROJECT_ACTIONJOURNAL_H
+#include "Game.h"
+#include <vector>
+#include <cstdint>
+
+namespace mtm
+{
+    /**
+    * class ActionJournal:
+    *      a compact binary log of the successful actions of a game, that can be replayed to reproduce the game.
+    *      the journal starts with a snapshot of the game at the moment it was created, and a new snapshot
+    *      (checkpoint) is embedded after every checkpoint_interval actions, so replaying up to a given action
+    *      only re-executes the actions since the last checkpoint before it.
+    *      the format is the header "RPGJ" and the format version (u32), followed by entries that start with their
+    *      type (u8):
+    *          add character - row, col (i32), type, team (u8), health, ammo, range, power, strikes counter (i32).
+    *          move / attack - src row, src col, dst row, dst col (i32).
+    *          reload - row, col (i32).
+    *          checkpoint - number of actions before it (u64), snapshot size (u64), GameSnapshot data.
+    *      all the numbers are little endian.
+    *      a change of the game that is not an action, like an undo or an assignment of another game, is recorded as
+    *      a checkpoint of the game after it.
+    *      the actions of a journal that was loaded from data are checked against the replayed game before they are
+    *      performed, with the checks of the action in the game, so a corrupted journal fails with InvalidSnapshot
+    *      instead of corrupting the replayed game. a journal that recorded the actions itself is trusted, and its
+    *      actions are replayed without the checks.
+    */
+    class ActionJournal {
+    private:
+        enum EntryType { ADD_CHARACTER_ENTRY, MOVE_ENTRY, ATTACK_ENTRY, RELOAD_ENTRY, CHECKPOINT_ENTRY };
+
+        /**
+        * struct Checkpoint:
+        *      the location of an embedded snapshot in the journal.
+        */
+        struct Checkpoint {
+            uint64_t num_of_actions;
+            size_t snapshot_offset;
+            size_t snapshot_size;
+        };
+
+        static const char MAGIC[4];
+        static const uint32_t FORMAT_VERSION;
+        static const size_t HEADER_SIZE;
+        static const size_t CHECKPOINT_HEADER_SIZE;
+        static const size_t ADD_CHARACTER_ENTRY_SIZE;
+        static const size_t TWO_CELLS_ENTRY_SIZE;
+        static const size_t ONE_CELL_ENTRY_SIZE;
+
+        std::vector<char> data;
+        std::vector<Checkpoint> checkpoints;
+        uint64_t num_of_actions;
+        uint64_t checkpoint_interval;
+        bool is_trusted;
+
+        /**
+        * writeCoordinates: appends coordinates to the journal data.
+        * @param coordinates : the coordinates to append.
+        */
+        void writeCoordinates(const GridPoint& coordinates);
+        /**
+        * readCoordinates: reads coordinates from the journal data.
+        * @param position : pointer to the first byte of the coordinates.
+        * @return the coordinates.
+        */
+        static GridPoint readCoordinates(const char* position);
+        /**
+        * isAddedCharacterValid: checks the character of an add character entry - its type, team and stats.
+        * @param entry : pointer to the first byte of the entry.
+        * @return true if the entry describes a valid character.
+        */
+        static bool isAddedCharacterValid(const char* entry);
+        /**
+        * writeCheckpoint: appends a snapshot of the game to the journal.
+        * @param game : the game to take the snapshot of.
+        */
+        void writeCheckpoint(const Game& game);
+        /**
+        * finishAction: counts an action that was appended to the journal, and appends a checkpoint if it is due.
+        * @param game : the game after the action.
+        */
+        void finishAction(const Game& game);
+        /**
+        * applyEntry: replays the action entry at the given position of the data on a game.
+        * @param game : the game to replay the action on.
+        * @param position : the position of the entry in the data.
+        * @param check_action : true to check the action against the game before it is performed, false to
+        * perform it right away.
+        * @return the position of the next entry.
+        * possible errors:
+        *      - InvalidSnapshot : if the action is checked and cannot be performed on the game.
+        */
+        size_t applyEntry(Game& game, size_t position, bool check_action) const;
+
+    public:
+        /**
+        * constructor of the journal that receives 2 parameters.
+        * @param initial_game : the game the journal starts from. its current state is saved as the first checkpoint.
+        * @param checkpoint_interval : the number of actions between embedded checkpoints, 0 for no checkpoints
+        * other than the first one.
+        */
+        ActionJournal(const Game& initial_game, uint64_t checkpoint_interval);
+        /**
+        * constructor of the journal that receives 2 parameters - loads a journal that was saved with getData.
+        * @param data : pointer to the first byte of the journal.
+        * @param size : the size of the journal in bytes.
+        * the journal is not trusted, so its actions are checked when it is replayed.
+        * possible errors:
+        *      - InvalidSnapshot : if the data is not a well formed journal - it has an unknown or truncated entry,
+        *        an added character with an invalid type, team or stats, or a checkpoint out of order.
+        */
+        ActionJournal(const char* data, size_t size);
+        /**
+        * recordAddCharacter: appends an addCharacter action to the journal.
+        * @param game : the game after the action.
+        * @param coordinates : the coordinates the character was added to.
+        * @param character : the character that was added.
+        */
+        void recordAddCharacter(const Game& game, const GridPoint& coordinates, const Character& character);
+        /**
+        * recordMove: appends a move action to the journal.
+        * @param game : the game after the action.
+        * @param src_coordinates : the coordinates the character was moved from.
+        * @param dst_coordinates : the coordinates the character was moved to.
+        */
+        void recordMove(const Game& game, const GridPoint& src_coordinates, const GridPoint& dst_coordinates);
+        /**
+        * recordAttack: appends an attack action to the journal.
+        * @param game : the game after the action.
+        * @param src_coordinates : the coordinates of the attacker.
+        * @param dst_coordinates : the coordinates of the main target.
+        */
+        void recordAttack(const Game& game, const GridPoint& src_coordinates, const GridPoint& dst_coordinates);
+        /**
+        * recordReload: appends a reload action to the journal.
+        * @param game : the game after the action.
+        * @param coordinates : the coordinates of the character that was reloaded.
+        */
+        void recordReload(const Game& game, const GridPoint& coordinates);
+        /**
+        * recordCheckpoint: appends a checkpoint of the game after a change that is not an action, so replaying
+        * continues from the changed game.
+        * @param game : the game after the change.
+        */
+        void recordCheckpoint(const Game& game);
+        /**
+        * getNumOfActions: returns the number of actions in the journal.
+        * @return the number of actions.
+        */
+        uint64_t getNumOfActions() const;
+        /**
+        * getData: returns the binary content of the journal, to be saved and loaded later.
+        * @return the data of the journal.
+        */
+        const std::vector<char>& getData() const;
+        /**
+        * isTrusted: checks if the journal recorded its actions itself, so they are replayed without checks.
+        * @return true if the journal was created from a game, false if it was loaded from data.
+        */
+        bool isTrusted() const;
+        /**
+        * replay: reproduces the game after all the actions of the journal.
+        * @return the game after the last action.
+        * possible errors:
+        *      - InvalidSnapshot : if the journal was loaded from data and an action of it cannot be performed on
+        *        the replayed game.
+        */
+        Game replay() const;
+        /**
+        * replay: reproduces the game after a given number of actions, starting from the last checkpoint before it.
+        * @param num_of_actions : the number of actions to reproduce the game after.
+        * @return the game after the given number of actions, and after the changes that were recorded as
+        * checkpoints right after them.
+        * possible errors:
+        *      - IllegalArgument : if the journal has less actions than the given number.
+        *      - InvalidSnapshot : if the journal was loaded from data and an action of it cannot be performed on
+        *        the replayed game.
+        */
+        Game replay(uint64_t num_of_actions) const;
+    };
+}
+
+#endif //GAME_PROJECT_ACTIONJOURNAL_H
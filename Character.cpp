@@ -1,13 +1,16 @@
 #include "Character.h"
+#include <limits>
+
 namespace mtm
 {
     Character::Character(units_t health_points, units_t ammo, units_t range, units_t power, mtm::Team team,
                          units_t movement_range, units_t reload_ammo_addition, units_t attack_ammo_cost,
-                         char identifier_char_powerlifters, char identifier_char_crossfitters) :
+                         char identifier_char_powerlifters, char identifier_char_crossfitters,
+                         mtm::CharacterType type) :
             health_points(health_points), ammo_points(ammo), range(range), power(power), team(team),
             movement_range(movement_range), reload_ammo_addition(reload_ammo_addition),
             attack_ammo_cost(attack_ammo_cost), identifier_char_powerlifters(identifier_char_powerlifters),
-            identifier_char_crossfitters(identifier_char_crossfitters){
+            identifier_char_crossfitters(identifier_char_crossfitters), type(type){
     }
 
     units_t Character::getCharacterHealthPoints() const {
@@ -30,6 +33,10 @@ namespace mtm
         return this->team;
     }
 
+    mtm::CharacterType Character::getCharacterType() const {
+        return this->type;
+    }
+
     units_t Character::getCharacterMovementRange() const {
         return movement_range;
     }
@@ -54,15 +61,42 @@ namespace mtm
         return (getCharacterHealthPoints() > 0);
     }
 
-    bool Character::isCharacterHasEnoughAmmo(const std::shared_ptr<Character>& target_ptr) const {
+    bool Character::isCharacterHasEnoughAmmo(const Character* target_ptr) const {
         return (this->getCharacterAmmo() >= this->getCharacterAttackAmmoCost());
     }
 
-    bool Character::isTargetOnSameTeam(const std::shared_ptr<Character>& target) const {
+    bool Character::isCharacterHasEnoughAmmo(const std::shared_ptr<Character>& target_ptr) const {
+        return isCharacterHasEnoughAmmo(target_ptr.get());
+    }
+
+    bool Character::isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
+                                  const std::shared_ptr<Character>& target) const {
+        return isStrikeLegal(src_coordinates, dst_coordinates, target.get());
+    }
+
+    units_t Character::performStrike(const mtm::GridPoint& src_coordinates,
+                                     const mtm::GridPoint& main_target_coordinates,
+                                     const mtm::GridPoint& current_target_coordinates,
+                                     const std::shared_ptr<Character>& target) {
+        return performStrike(src_coordinates, main_target_coordinates, current_target_coordinates, target.get());
+    }
+
+    int Character::getSuccessfulStrikesCounter() const {
+        return 0;
+    }
+
+    void Character::setSuccessfulStrikesCounter(int) {
+    }
+
+    units_t Character::getCharacterStrikeAreaRadius() const {
+        return std::numeric_limits<units_t>::max();
+    }
+
+    bool Character::isTargetOnSameTeam(const Character* target) const {
         return (this->getCharacterTeam() == (*target).getCharacterTeam());
     }
 
-    bool Character::isTargetEmpty(const std::shared_ptr<Character>& target) {
+    bool Character::isTargetEmpty(const Character* target) {
         return (target == nullptr);
     }
 
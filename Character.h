@@ -21,29 +21,9 @@ namespace mtm
         units_t attack_ammo_cost;
         char identifier_char_powerlifters;
         char identifier_char_crossfitters;
-
-        /**
-        * getCharacterHealthPoints: returns the number of health points of the character.
-        * @return:character's health points field.
-        */
-        units_t getCharacterHealthPoints() const;
+        mtm::CharacterType type;
 
     protected:
-        /**
-        * getCharacterAmmo: returns the ammo points of the character.
-        * @return character's ammo field.
-        */
-        units_t getCharacterAmmo() const;
-        /**
-        * getCharacterRange : returns the range of the character.
-        * @return character's range field.
-        */
-        units_t getCharacterRange() const;
-        /**
-        * getCharacterPower: returns the power of the character.
-        * @return character's power field.
-        */
-        units_t getCharacterPower() const;
         /**
         * getCharacterAttackAmmoCost :returns the ammo cost of performing attack by the character
         * @return : character's attack ammo cost field.
@@ -54,17 +34,17 @@ namespace mtm
         * @param target : the target we want to compare his team to the class's character.
         * @return : true if the entered character is in the same time as the current character
         */
-        bool isTargetOnSameTeam(const std::shared_ptr<Character>& target) const;
+        bool isTargetOnSameTeam(const Character* target) const;
         /**
         * isTargetEmpty: checks if a given target is an active player in the game.
         * @param target : the target we want to check if it's contains any active character.
         * @return true if the given target is not an active character in the game
         */
-        static bool isTargetEmpty(const std::shared_ptr<Character>& target);
+        static bool isTargetEmpty(const Character* target);
 
     public:
         /**
-        * constructor of the character class that receives 10 parameters.
+        * constructor of the character class that receives 11 parameters.
         * @param health_points : represents the life of the character - when it gets to 0 the character is dead.
         * @param ammo : the character need ammo in order to perform an attack.
         * @param range : represents which coordinates can be attacked by the character from it current place.
@@ -75,10 +55,14 @@ namespace mtm
         * @param attack_ammo_cost : amount of ammo that is being reduced from the character's ammo in attack action.
         * @param identifier_char_powerlifters : the identifier char of the character as a powerlifter.
         * @param identifier_char_crossfitters : the identifier char of the character as a crossfitter.
+        * @param type : the type of the character - soldier, medic or sniper. character classes other than the built
+        * in ones may leave it out, and are then reported as SOLDIER by getCharacterType - the code that depends on
+        * the exact class checks it with typeid.
         */
         Character(units_t health_points, units_t ammo, units_t range, units_t power, mtm::Team team,
                   units_t movement_range, units_t reload_ammo_addition, units_t attack_ammo_cost,
-                  char identifier_char_powerlifters, char identifier_char_crossfitters) ;
+                  char identifier_char_powerlifters, char identifier_char_crossfitters,
+                  mtm::CharacterType type = mtm::SOLDIER) ;
         //
         /**
         * ~Character: default constructor of the character.
@@ -91,6 +75,31 @@ namespace mtm
         */
         mtm::Team getCharacterTeam() const;
         /**
+        * getCharacterType : returns the type of the character - soldier, medic or sniper.
+        * @return character's type field.
+        */
+        mtm::CharacterType getCharacterType() const;
+        /**
+        * getCharacterHealthPoints: returns the number of health points of the character.
+        * @return:character's health points field.
+        */
+        units_t getCharacterHealthPoints() const;
+        /**
+        * getCharacterAmmo: returns the ammo points of the character.
+        * @return character's ammo field.
+        */
+        units_t getCharacterAmmo() const;
+        /**
+        * getCharacterRange : returns the range of the character.
+        * @return character's range field.
+        */
+        units_t getCharacterRange() const;
+        /**
+        * getCharacterPower: returns the power of the character.
+        * @return character's power field.
+        */
+        units_t getCharacterPower() const;
+        /**
         * getCharacterMovementRange: returns the character maximal movement range according to his inner field.
         * @return character's movement range field.
         */
@@ -125,15 +134,36 @@ namespace mtm
         /**
         * isCharacterHasEnoughAmmo : checks if character has enough ammo to perform attack.
         * @param target_ptr : the target of the attack in order to check if it's on the same team as the character.
+        * borrowed for the duration of the call, null if the target cell is empty.
         * @return true if the character can perform the attack.
         */
-        virtual bool isCharacterHasEnoughAmmo(const std::shared_ptr<Character>& target_ptr) const;
+        virtual bool isCharacterHasEnoughAmmo(const Character* target_ptr) const;
+        /**
+        * getSuccessfulStrikesCounter: returns the number of strikes the character has performed so far, for the
+        * character types whose strikes depend on it.
+        * @return 0 by default - the character does not count its strikes.
+        */
+        virtual int getSuccessfulStrikesCounter() const;
+        /**
+        * setSuccessfulStrikesCounter: sets the number of strikes the character has performed so far. used when a
+        * character is restored from a stored state.
+        * @param counter : the new value of the successful strikes counter. ignored by default - the character does
+        * not count its strikes.
+        */
+        virtual void setSuccessfulStrikesCounter(int counter);
         /**
         * clone: creates a copy of the character instance.
         * @return absolute copy of the character and his inner fields.
         */
         virtual std::shared_ptr<Character> clone() const = 0;
         /**
+        * getCharacterStrikeAreaRadius: returns the radius around the main target that a strike of the character
+        * can affect. cells further than this distance from the main target are never hit by the strike.
+        * @return by default a radius that covers the whole board, so performStrike is called for every occupied
+        * cell. character classes whose strikes hit a smaller area should override it.
+        */
+        virtual units_t getCharacterStrikeAreaRadius() const;
+        /**
         * isTargetInStrikeRange: checks if the target is in the character strike's range.
         * @param src_coordinates : the coordinates of the character (attacker).
         * @param dst_coordinates : the coordinates of the target.
@@ -146,25 +176,38 @@ namespace mtm
         * isStrikeLegal: checks if the strike is legal according to the character limitations;
         * @param src_coordinates : the coordinates of the character (attacker).
         * @param dst_coordinates : the coordinates of the target.
-        * @param target : the character which is the target of the attack.
+        * @param target : the character which is the target of the attack. borrowed for the duration of the call,
+        * null if the target cell is empty.
         * @return true if the attack is legal and can be performed.
         */
         virtual bool isStrikeLegal(const mtm::GridPoint& src_coordinates,
                                    const mtm::GridPoint& dst_coordinates,
-                                   std::shared_ptr<Character> target) const = 0;
+                                   const Character* target) const = 0;
         /**
         * performStrike: performs the strike.
         * @param src_coordinates : the coordinates of the character (attacker).
         * @param main_target_coordinates : the coordinates of the main target.
         * @param current_target_coordinates  the coordinates of the current target - might be any coordinates
         * over the game board.
-        * @param target : the current target of the attack - might be any character over the board.
+        * @param target : the current target of the attack - might be any character over the board. borrowed for the
+        * duration of the call, null if the current cell is empty.
         * @return amount of health points to add/reduce from the target's health points
         */
         virtual units_t performStrike(const mtm::GridPoint& src_coordinates,
                                       const mtm::GridPoint& main_target_coordinates,
                                       const mtm::GridPoint& current_target_coordinates,
-                                      std::shared_ptr<Character> target) = 0;
+                                      const Character* target) = 0;
+        /**
+        * isCharacterHasEnoughAmmo, isStrikeLegal, performStrike: the shared_ptr forms of the checks and the strike,
+        * kept for callers that hold the target as a shared_ptr. they borrow the target and call the virtual
+        * methods above, so character classes override only the borrowed pointer forms.
+        */
+        bool isCharacterHasEnoughAmmo(const std::shared_ptr<Character>& target_ptr) const;
+        bool isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
+                           const std::shared_ptr<Character>& target) const;
+        units_t performStrike(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& main_target_coordinates,
+                              const mtm::GridPoint& current_target_coordinates,
+                              const std::shared_ptr<Character>& target);
     };
 }
 
@@ -0,0 +1,125 @@
+#include "CharacterPool.h"
+#include <new>
+
+namespace mtm
+{
+    const size_t CharacterPool::SIZE_CLASS_GRANULARITY;
+    const int CharacterPool::NUM_OF_SIZE_CLASSES;
+    const int CharacterPool::BLOCKS_PER_SLAB;
+
+    thread_local CharacterPool::FreeBlock* CharacterPool::free_lists[CharacterPool::NUM_OF_SIZE_CLASSES];
+    thread_local bool CharacterPool::is_thread_exiting = false;
+    thread_local CharacterPool::Statistics CharacterPool::statistics;
+    std::mutex CharacterPool::depot_lock;
+    CharacterPool::FreeBlock* CharacterPool::depot[CharacterPool::NUM_OF_SIZE_CLASSES];
+
+    CharacterPool::ThreadExitHook::~ThreadExitHook() {
+        std::lock_guard<std::mutex> guard(depot_lock);
+        for (int size_class = 0; size_class < NUM_OF_SIZE_CLASSES; size_class++)
+        {
+            while (free_lists[size_class] != nullptr)
+            {
+                FreeBlock* block = free_lists[size_class];
+                free_lists[size_class] = block->next;
+                block->next = depot[size_class];
+                depot[size_class] = block;
+            }
+        }
+        is_thread_exiting = true;
+    }
+
+    int CharacterPool::getSizeClass(size_t size) {
+        if (size == 0)
+        {
+            return 0;
+        }
+        size_t size_class = (size - 1) / SIZE_CLASS_GRANULARITY;
+        return size_class < NUM_OF_SIZE_CLASSES ? static_cast<int>(size_class) : NUM_OF_SIZE_CLASSES;
+    }
+
+    size_t CharacterPool::getBlockSize(int size_class) {
+        return (size_class + 1) * SIZE_CLASS_GRANULARITY;
+    }
+
+    void CharacterPool::registerThreadExitHook() {
+        static thread_local ThreadExitHook exit_hook;
+        (void)exit_hook;
+    }
+
+    void CharacterPool::refill(int size_class) {
+        registerThreadExitHook();
+        {
+            std::lock_guard<std::mutex> guard(depot_lock);
+            if (depot[size_class] != nullptr)
+            {
+                free_lists[size_class] = depot[size_class];
+                depot[size_class] = nullptr;
+                return;
+            }
+        }
+        size_t block_size = getBlockSize(size_class);
+        char* slab = static_cast<char*>(::operator new(block_size * BLOCKS_PER_SLAB));
+        statistics.slab_allocations++;
+        for (int i = BLOCKS_PER_SLAB - 1; i >= 0; i--)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * block_size);
+            block->next = free_lists[size_class];
+            free_lists[size_class] = block;
+        }
+    }
+
+    void* CharacterPool::allocate(size_t size) {
+        int size_class = getSizeClass(size);
+        if (size_class == NUM_OF_SIZE_CLASSES)
+        {
+            statistics.fallback_allocations++;
+            return ::operator new(size);
+        }
+        if (is_thread_exiting)
+        {
+            statistics.fallback_allocations++;
+            return ::operator new(getBlockSize(size_class));
+        }
+        if (free_lists[size_class] == nullptr)
+        {
+            refill(size_class);
+        }
+        FreeBlock* block = free_lists[size_class];
+        free_lists[size_class] = block->next;
+        statistics.pool_allocations++;
+        return block;
+    }
+
+    void CharacterPool::deallocate(void* block, size_t size) {
+        int size_class = getSizeClass(size);
+        if (size_class == NUM_OF_SIZE_CLASSES)
+        {
+            ::operator delete(block);
+            return;
+        }
+        FreeBlock* free_block = static_cast<FreeBlock*>(block);
+        statistics.pool_deallocations++;
+        if (is_thread_exiting)
+        {
+            std::lock_guard<std::mutex> guard(depot_lock);
+            free_block->next = depot[size_class];
+            depot[size_class] = free_block;
+            return;
+        }
+        if (free_lists[size_class] == nullptr)
+        {
+            registerThreadExitHook();
+        }
+        free_block->next = free_lists[size_class];
+        free_lists[size_class] = free_block;
+    }
+
+    CharacterPool::Statistics CharacterPool::getThreadStatistics() {
+        return statistics;
+    }
+
+    void CharacterPool::resetThreadStatistics() {
+        Statistics empty_statistics = {0, 0, 0, 0};
+        statistics = empty_statistics;
+    }
+}
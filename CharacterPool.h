@@ -0,0 +1,111 @@
+#ifndef GAME_PROJECT_CHARACTERPOOL_H
+#define GAME_PROJECT_CHARACTERPOOL_H
+#include <cstddef>
+#include <mutex>
+
+namespace mtm
+{
+    /**
+    * class CharacterPool:
+    *      a small object allocator for characters and their shared_ptr control blocks.
+    *      the blocks are grouped in size classes. every thread keeps a free list of every size class, so allocating
+    *      and freeing a block is a free list pop or push without locking. empty free lists are refilled from a
+    *      shared depot of blocks that exited threads left behind, or else from a new slab of blocks.
+    *      blocks that are allocated while a thread exits are taken from operator new in the size of their class,
+    *      so they can join the depot when they are freed.
+    *      slabs are never returned to the system - freed blocks are kept for reuse for the lifetime of the program.
+    *      blocks that are bigger than the biggest size class are taken from operator new.
+    */
+    class CharacterPool {
+    public:
+        /**
+        * struct Statistics:
+        *      counters of the allocations of a thread.
+        */
+        struct Statistics {
+            unsigned long long pool_allocations;
+            unsigned long long pool_deallocations;
+            unsigned long long slab_allocations;
+            unsigned long long fallback_allocations;
+        };
+
+    private:
+        static const size_t SIZE_CLASS_GRANULARITY = 16;
+        static const int NUM_OF_SIZE_CLASSES = 16;
+        static const int BLOCKS_PER_SLAB = 256;
+
+        /**
+        * struct FreeBlock:
+        *      a block in a free list.
+        */
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        /**
+        * class ThreadExitHook:
+        *      moves the free lists of a thread to the depot when the thread exits.
+        */
+        class ThreadExitHook {
+        public:
+            ThreadExitHook() = default;
+            ~ThreadExitHook();
+        };
+
+        static thread_local FreeBlock* free_lists[NUM_OF_SIZE_CLASSES];
+        static thread_local bool is_thread_exiting;
+        static thread_local Statistics statistics;
+        static std::mutex depot_lock;
+        static FreeBlock* depot[NUM_OF_SIZE_CLASSES];
+
+        /**
+        * getSizeClass: returns the size class of a block size.
+        * @param size : the size of the block in bytes.
+        * @return the index of the size class, or NUM_OF_SIZE_CLASSES if the block is too big for the pool.
+        */
+        static int getSizeClass(size_t size);
+        /**
+        * getBlockSize: returns the size of the blocks of a size class.
+        * @param size_class : the index of the size class.
+        * @return the size of the blocks in bytes.
+        */
+        static size_t getBlockSize(int size_class);
+        /**
+        * registerThreadExitHook: makes sure the free lists of the current thread are moved to the depot when the
+        * thread exits.
+        */
+        static void registerThreadExitHook();
+        /**
+        * refill: fills the empty free list of a size class of the current thread from the depot or a new slab.
+        * @param size_class : the index of the size class.
+        */
+        static void refill(int size_class);
+
+    public:
+        /**
+        * allocate: allocates a block.
+        * @param size : the size of the block in bytes.
+        * @return pointer to the block, aligned for any fundamental type.
+        * possible errors:
+        *      - std::bad_alloc : if there is not enough memory.
+        */
+        static void* allocate(size_t size);
+        /**
+        * deallocate: frees a block that was allocated by allocate, possibly by another thread.
+        * @param block : pointer to the block.
+        * @param size : the size the block was allocated with.
+        */
+        static void deallocate(void* block, size_t size);
+        /**
+        * getThreadStatistics: returns the allocation counters of the current thread.
+        * @return the counters.
+        */
+        static Statistics getThreadStatistics();
+        /**
+        * resetThreadStatistics: sets the allocation counters of the current thread to 0.
+        */
+        static void resetThreadStatistics();
+    };
+}
+
+#endif //GAME_PROJECT_CHARACTERPOOL_H
@@ -0,0 +1,119 @@
+#include "DamageKernel.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define DAMAGE_KERNEL_DISPATCH_AVX2
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define DAMAGE_KERNEL_USE_SSE2
+#endif
+
+namespace mtm
+{
+    namespace
+    {
+        typedef int (*DamageFieldPass)(units_t* health_points, const units_t* damage, int first, int num_of_units);
+
+        int scalarDamagePass(units_t* health_points, const units_t* damage, int first, int num_of_units)
+        {
+            int num_of_deaths = 0;
+            for (int i = first; i < num_of_units; i++)
+            {
+                units_t new_health = health_points[i] - damage[i];
+                num_of_deaths += static_cast<int>((health_points[i] > 0) & (new_health <= 0));
+                health_points[i] = new_health;
+            }
+            return num_of_deaths;
+        }
+
+#if defined(DAMAGE_KERNEL_USE_SSE2)
+        int sse2DamagePass(units_t* health_points, const units_t* damage, int first, int num_of_units)
+        {
+            static_assert(sizeof(units_t) == 4, "the vectorized damage kernel works on 32 bit health points");
+            const __m128i zero = _mm_setzero_si128();
+            __m128i deaths = _mm_setzero_si128();
+            int i = first;
+            for (; i + 4 <= num_of_units; i += 4)
+            {
+                __m128i health = _mm_loadu_si128(reinterpret_cast<const __m128i*>(health_points + i));
+                __m128i new_health = _mm_sub_epi32(health,
+                                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(damage + i)));
+                __m128i died = _mm_andnot_si128(_mm_cmpgt_epi32(new_health, zero), _mm_cmpgt_epi32(health, zero));
+                deaths = _mm_sub_epi32(deaths, died);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(health_points + i), new_health);
+            }
+            int lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), deaths);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                   scalarDamagePass(health_points, damage, i, num_of_units);
+        }
+#endif
+
+#if defined(DAMAGE_KERNEL_DISPATCH_AVX2)
+        __attribute__((target("avx2")))
+        int avx2DamagePass(units_t* health_points, const units_t* damage, int first, int num_of_units)
+        {
+            static_assert(sizeof(units_t) == 4, "the vectorized damage kernel works on 32 bit health points");
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i deaths = _mm256_setzero_si256();
+            int i = first;
+            for (; i + 8 <= num_of_units; i += 8)
+            {
+                __m256i health = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(health_points + i));
+                __m256i new_health = _mm256_sub_epi32(health,
+                                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(damage + i)));
+                __m256i died = _mm256_andnot_si256(_mm256_cmpgt_epi32(new_health, zero),
+                                                   _mm256_cmpgt_epi32(health, zero));
+                deaths = _mm256_sub_epi32(deaths, died);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(health_points + i), new_health);
+            }
+            int lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), deaths);
+            int num_of_deaths = 0;
+            for (int lane = 0; lane < 8; lane++)
+            {
+                num_of_deaths += lanes[lane];
+            }
+            return num_of_deaths + scalarDamagePass(health_points, damage, i, num_of_units);
+        }
+#endif
+
+        struct DamageFieldImplementation {
+            DamageFieldPass pass;
+            const char* instruction_set;
+        };
+
+        DamageFieldImplementation selectDamageFieldImplementation()
+        {
+#if defined(DAMAGE_KERNEL_DISPATCH_AVX2)
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return {avx2DamagePass, "avx2"};
+            }
+#endif
+#if defined(DAMAGE_KERNEL_USE_SSE2)
+            return {sse2DamagePass, "sse2"};
+#else
+            return {scalarDamagePass, "scalar"};
+#endif
+        }
+
+        const DamageFieldImplementation& getDamageFieldImplementation()
+        {
+            static const DamageFieldImplementation implementation = selectDamageFieldImplementation();
+            return implementation;
+        }
+    }
+
+    int DamageKernel::applyDamageField(units_t* health_points, const units_t* damage, int num_of_units) {
+        return getDamageFieldImplementation().pass(health_points, damage, 0, num_of_units);
+    }
+
+    int DamageKernel::applyDamageFieldScalar(units_t* health_points, const units_t* damage, int num_of_units) {
+        return scalarDamagePass(health_points, damage, 0, num_of_units);
+    }
+
+    const char* DamageKernel::getInstructionSet() {
+        return getDamageFieldImplementation().instruction_set;
+    }
+}
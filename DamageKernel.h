@@ -0,0 +1,48 @@
+#ifndef GAME_PROJECT_DAMAGEKERNEL_H
+#define GAME_PROJECT_DAMAGEKERNEL_H
+#include "Auxiliaries.h"
+
+namespace mtm
+{
+    /**
+    * class DamageKernel:
+    *      vectorized passes over arrays of health points, for structure-of-arrays unit stores.
+    *      the pass is picked once, at the first call: AVX2 when the processor supports it (on GCC and Clang x86
+    *      builds the AVX2 version is compiled for it regardless of the target flags of the build), SSE2 on other
+    *      x86 targets, and a scalar loop elsewhere. all the implementations give the same results.
+    *      the attacks of Game do not use these passes - the health points of its characters live in the character
+    *      objects on the board, and every hit cell also updates the position hash, the change log and the undo
+    *      records. collecting the hit cells of an area strike into arrays, resolving them with applyDamageField and
+    *      writing them back made BM_GameAreaStrike 10-15% slower, since that per-cell work stays. the passes are
+    *      meant for area effects that are resolved on a UnitStore that was filled by Game::exportUnits.
+    */
+    class DamageKernel {
+    public:
+        /**
+        * applyDamageField: subtracts a damage value from every health value, and counts the units that were alive
+        * before the pass and are not alive after it.
+        * @param health_points : the health points of the units. updated in place.
+        * @param damage : the damage of every unit, 0 for units that are not hit. negative damage heals.
+        * @param num_of_units : the number of units in both arrays.
+        * @return the number of units that died in the pass.
+        */
+        static int applyDamageField(units_t* health_points, const units_t* damage, int num_of_units);
+
+        /**
+        * applyDamageFieldScalar: the scalar version of applyDamageField, for comparing against the vectorized pass.
+        * @param health_points : the health points of the units. updated in place.
+        * @param damage : the damage of every unit, 0 for units that are not hit. negative damage heals.
+        * @param num_of_units : the number of units in both arrays.
+        * @return the number of units that died in the pass.
+        */
+        static int applyDamageFieldScalar(units_t* health_points, const units_t* damage, int num_of_units);
+
+        /**
+        * getInstructionSet: returns the instruction set of the pass that applyDamageField uses on this processor.
+        * @return "avx2", "sse2" or "scalar".
+        */
+        static const char* getInstructionSet();
+    };
+}
+
+#endif //GAME_PROJECT_DAMAGEKERNEL_H
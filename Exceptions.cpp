@@ -1,56 +1,67 @@
 #include "Exceptions.h"
 
+#define GAME_ERROR_BASE_MSG "A game related error has occurred: "
+#define GAME_ERROR_MSG(error) GAME_ERROR_BASE_MSG #error
+
 namespace mtm
 {
-    using std::string;
-    static const char* const ILLEGAL_ARGUMENT_STR = "IllegalArgument";
-    static const char* const ILLEGAL_CELL_STR = "IllegalCell";
-    static const char* const CELL_EMPTY_STR = "CellEmpty";
-    static const char* const MOVE_TOO_FAR_STR = "MoveTooFar";
-    static const char* const CELL_OCCUPIED_STR = "CellOccupied";
-    static const char* const OUT_OF_RANGE_STR = "OutOfRange";
-    static const char* const OUT_OF_AMMO_STR = "OutOfAmmo";
-    static const char* const ILLEGAL_TARGET_STR = "IllegalTarget";
-    const char* mtm::Exception::BASE_MSG = "A game related error has occurred: ";
+    static const char* const BASE_MSG = GAME_ERROR_BASE_MSG;
+    static const char* const ILLEGAL_ARGUMENT_STR = GAME_ERROR_MSG(IllegalArgument);
+    static const char* const ILLEGAL_CELL_STR = GAME_ERROR_MSG(IllegalCell);
+    static const char* const CELL_EMPTY_STR = GAME_ERROR_MSG(CellEmpty);
+    static const char* const MOVE_TOO_FAR_STR = GAME_ERROR_MSG(MoveTooFar);
+    static const char* const CELL_OCCUPIED_STR = GAME_ERROR_MSG(CellOccupied);
+    static const char* const OUT_OF_RANGE_STR = GAME_ERROR_MSG(OutOfRange);
+    static const char* const OUT_OF_AMMO_STR = GAME_ERROR_MSG(OutOfAmmo);
+    static const char* const ILLEGAL_TARGET_STR = GAME_ERROR_MSG(IllegalTarget);
+    static const char* const INVALID_SNAPSHOT_STR = GAME_ERROR_MSG(InvalidSnapshot);
 
     const char *mtm::Exception::what() const noexcept {
-        return this->msg.c_str();
+        return this->msg != nullptr ? this->msg : this->error_msg.c_str();
     }
 
+    mtm::Exception::Exception(const StaticMessage& message) :
+            msg(message.full_msg), error_msg()
+    {}
+
     mtm::Exception::Exception(const std::string& error) :
-            msg(BASE_MSG + error)
+            msg(nullptr), error_msg(BASE_MSG + error)
     {}
 
     mtm::IllegalArgument::IllegalArgument() :
-            Exception(ILLEGAL_ARGUMENT_STR)
+            Exception(StaticMessage{ILLEGAL_ARGUMENT_STR})
     {}
 
     mtm::IllegalCell::IllegalCell() :
-            Exception(ILLEGAL_CELL_STR)
+            Exception(StaticMessage{ILLEGAL_CELL_STR})
     {}
 
     mtm::CellEmpty::CellEmpty() :
-            Exception(CELL_EMPTY_STR)
+            Exception(StaticMessage{CELL_EMPTY_STR})
     {}
 
     mtm::MoveTooFar::MoveTooFar() :
-            Exception(MOVE_TOO_FAR_STR)
+            Exception(StaticMessage{MOVE_TOO_FAR_STR})
     {}
 
     mtm::CellOccupied::CellOccupied() :
-            Exception(CELL_OCCUPIED_STR)
+            Exception(StaticMessage{CELL_OCCUPIED_STR})
     {}
 
     mtm::OutOfRange::OutOfRange() :
-            Exception(OUT_OF_RANGE_STR)
+            Exception(StaticMessage{OUT_OF_RANGE_STR})
     {}
 
     mtm::OutOfAmmo::OutOfAmmo() :
-            Exception(OUT_OF_AMMO_STR)
+            Exception(StaticMessage{OUT_OF_AMMO_STR})
     {}
 
     mtm::IllegalTarget::IllegalTarget() :
-            Exception(ILLEGAL_TARGET_STR)
+            Exception(StaticMessage{ILLEGAL_TARGET_STR})
+    {}
+
+    mtm::InvalidSnapshot::InvalidSnapshot() :
+            Exception(StaticMessage{INVALID_SNAPSHOT_STR})
     {}
 
 }
@@ -2,6 +2,7 @@
 #define GAME_PROJECT_EXCEPTIONS_H
 
 #include <iostream>
+#include <string>
 
 namespace mtm
 {
@@ -12,8 +13,23 @@ namespace mtm
     */
     class Exception : public std::exception {
     private:
-        std::string msg;
-        static const char* BASE_MSG;
+        const char* msg;
+        std::string error_msg;
+    protected:
+        /**
+        * struct StaticMessage:
+        *      a complete message with static storage, for the exceptions of the game. the exception only keeps a
+        *      pointer to it, so constructing and throwing the exception never allocates.
+        */
+        struct StaticMessage {
+            const char* full_msg;
+        };
+
+        /**
+        * constructor that receives 1 parameter.
+        * @param message : the complete message that the what method returns.
+        */
+        explicit Exception(const StaticMessage& message);
     public:
         /**
         * what: method the returns an info string about the exception.
@@ -22,7 +38,8 @@ namespace mtm
         const char* what() const noexcept override;
         /**
         * constructor that receives 1 parameter.
-        * @param error : error message to print as part of the what method.
+        * @param error : error message to print as part of the what method. the message is built when the
+        * exception is constructed, so unlike the exceptions of the game this constructor allocates.
         */
         explicit Exception(const std::string& error);
         /**
@@ -102,6 +119,15 @@ namespace mtm
     public:
         IllegalTarget();
     };
+    /**
+    * class InvalidSnapshot
+    * inherits from class Exception.
+    * exception is called when a saved game cannot be read or written, or its content is not a valid game.
+    */
+    class InvalidSnapshot : public Exception {
+    public:
+        InvalidSnapshot();
+    };
 }
 
 #endif //GAME_PROJECT_EXCEPTIONS_H
@@ -2,7 +2,18 @@
 #include "Soldier.h"
 #include "Medic.h"
 #include "Sniper.h"
-#include <cstring>
+#include "ActionJournal.h"
+#include "PoolAllocator.h"
+#include "ZobristHash.h"
+#include "Instrumentation.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cassert>
+#include <utility>
+#include <typeinfo>
+#include <thread>
+#include <exception>
+#include <type_traits>
 
 namespace mtm
 {
@@ -10,67 +21,150 @@ namespace mtm
     using std::shared_ptr;
     using std::string;
 
-    Game::Game(int height, int width) : height(height), width(width)
+    const int Game::RENDER_CHUNK_CELLS;
+    const size_t Game::MAX_CHANGE_LOG_SIZE = 1 << 16;
+    const long long Game::LIVE_UNITS_CHECK_CELLS_PER_ACTION = 64;
+    const long long Game::PARALLEL_STRIKE_MIN_CELLS = 1 << 16;
+    const char Game::EMPTY_CELL_CHAR = ' ';
+    const char Game::CELL_SEPARATOR_CHAR = '|';
+    const char Game::BORDER_CHAR = '*';
+
+    Game::Game(int height, int width) : height(height), width(width), board(0, 0), occupancy(0, 0),
+    live_units_per_team(), board_version(0), change_log_base_version(0), change_log(), journal(nullptr),
+    strike_threads(1), position_hash(0), is_undo_enabled(false), undo_entries(), undo_frames(),
+    is_in_batch(false), is_batch_recorded(false)
     {
         if ((height <= 0 ) || (width <= 0))
         {
             throw IllegalArgument();
         }
-        this->board = vector<vector<shared_ptr<Character>>>(
-                height,vector<shared_ptr<Character>>(width, nullptr));
+        this->board = TiledBoard(height, width);
+        this->occupancy = OccupancyIndex(height, width);
     }
 
-    Game::Game(const Game &other) :height(other.height), width(other.width),
-    board(other.height,vector<shared_ptr<Character>>(other.width,nullptr))
+    Game::Game(const Game &other) : Game(GAME_INSTRUMENT_EXPRESSION(COPY_OPERATION, other), false)
+    {}
+
+    Game::Game(const Game &other, bool share_tiles) : height(other.height), width(other.width), board(other.board),
+    occupancy(other.occupancy), live_units_per_team(other.live_units_per_team), board_version(other.board_version),
+    change_log_base_version(other.board_version), change_log(), journal(nullptr), strike_threads(other.strike_threads),
+    position_hash(other.position_hash), is_undo_enabled(other.is_undo_enabled), undo_entries(), undo_frames(),
+    is_in_batch(false), is_batch_recorded(false)
     {
-        for (int r = 0; r < height ; r++)
+        if (!share_tiles)
         {
-            for (int c = 0; c < width; c++)
-            {
-                if (other.board[r][c] == nullptr)
-                {
-                    continue;
-                }
-                board[r][c] = other.board[r][c].get()->clone();
-            }
+            board.detachTiles();
         }
     }
 
     bool Game::isCellEmpty(const GridPoint &coordinates) const {
-        return (getCharacterAtCoordinates(coordinates) == nullptr);
+        return (board.getCell(coordinates) == nullptr);
+    }
+
+    Game::Game(Game&& other) noexcept : height(other.height), width(other.width), board(std::move(other.board)),
+    occupancy(std::move(other.occupancy)), live_units_per_team(other.live_units_per_team),
+    board_version(other.board_version), change_log_base_version(other.change_log_base_version),
+    change_log(std::move(other.change_log)), journal(other.journal), strike_threads(other.strike_threads),
+    position_hash(other.position_hash), is_undo_enabled(other.is_undo_enabled),
+    undo_entries(std::move(other.undo_entries)), undo_frames(std::move(other.undo_frames)), is_in_batch(false),
+    is_batch_recorded(false)
+    {
+        other.clearBoard();
     }
 
     Game& Game::operator=(const Game &other){
-        vector<vector<shared_ptr<Character>>>
-                tmp_board(other.height,vector<shared_ptr<Character>>(other.width, nullptr));
-        for (int r = 0; r < other.height ; r++)
+        if (this == &other)
         {
-            for (int c = 0; c < other.width; c++)
-            {
-                GridPoint current_coordinates(r,c);
-                if (other.isCellEmpty(current_coordinates))
-                {
-                    continue;
-                }
-                tmp_board[r][c] = other.board[r][c].get()->clone();
-            }
+            return *this;
+        }
+        Game tmp_game(other);
+        takeBoard(tmp_game);
+        return *this;
+    }
+
+    Game& Game::operator=(Game&& other) {
+        if (this == &other)
+        {
+            return *this;
         }
-        this->board = tmp_board;
-        this->height = other.height;
-        this->width = other.width;
+        takeBoard(other);
         return *this;
     }
 
+    void Game::takeBoard(Game& other) {
+        height = other.height;
+        width = other.width;
+        board = std::move(other.board);
+        occupancy = std::move(other.occupancy);
+        live_units_per_team = other.live_units_per_team;
+        position_hash = other.position_hash;
+        board_version = std::max(board_version, other.board_version) + 1;
+        change_log_base_version = board_version;
+        change_log.clear();
+        undo_entries.clear();
+        undo_frames.clear();
+        other.clearBoard();
+        if (journal != nullptr)
+        {
+            journal->recordCheckpoint(*this);
+        }
+    }
+
+    void Game::clearBoard() {
+        height = 0;
+        width = 0;
+        board = TiledBoard(0, 0);
+        occupancy = OccupancyIndex(0, 0);
+        live_units_per_team = std::array<int, NUM_OF_TEAMS>();
+        position_hash = 0;
+        board_version++;
+        change_log_base_version = board_version;
+        change_log.clear();
+        journal = nullptr;
+        undo_entries.clear();
+        undo_frames.clear();
+    }
+
+    Game Game::fork() const {
+        return Game(*this, true);
+    }
+
     void Game::addCharacter(const GridPoint &coordinates, shared_ptr<Character> character) {
         if (areCoordinatesIllegal(coordinates))
         {
+            GAME_INSTRUMENT_EXCEPTION(ACTION_ILLEGAL_CELL);
             throw IllegalCell();
         }
         if (!isCellEmpty(coordinates))
         {
+            GAME_INSTRUMENT_EXCEPTION(ACTION_CELL_OCCUPIED);
             throw CellOccupied();
         }
-        board[coordinates.row][coordinates.col] = character;
+        applyAddCharacter(coordinates, character);
+        if (journal != nullptr)
+        {
+            journal->recordAddCharacter(*this, coordinates, *character);
+        }
+    }
+
+    void Game::applyAddCharacter(const GridPoint& coordinates, const shared_ptr<Character>& character) {
+        beginUndoRecord();
+        if (is_undo_enabled)
+        {
+            UndoEntry entry = {REMOVE_ADDED_ENTRY, coordinates.row, coordinates.col, 0, 0, 0, 0, 0, nullptr};
+            undo_entries.push_back(entry);
+        }
+        placeCharacter(coordinates, character);
+        startBoardVersion();
+        markCellChanged(coordinates);
+        checkLiveUnitsCounters();
+    }
+
+    void Game::placeCharacter(const GridPoint& coordinates, const shared_ptr<Character>& character) {
+        board.getWritableCell(coordinates) = character;
+        occupancy.markOccupied(coordinates);
+        live_units_per_team[character->getCharacterTeam()]++;
+        toggleCellHash(coordinates);
     }
 
     shared_ptr<Character> Game::makeCharacter(CharacterType type, Team team, units_t health,
@@ -82,163 +176,881 @@ namespace mtm
         shared_ptr<Character> character;
         switch(type) {
             case SOLDIER :
-                character = std::make_shared<Soldier>(health, ammo, range, power, team);
+                character = std::allocate_shared<Soldier>(PoolAllocator<Soldier>(), health, ammo, range, power, team);
                 break;
             case MEDIC  :
-                character = std::make_shared<Medic>(health, ammo, range, power, team);
+                character = std::allocate_shared<Medic>(PoolAllocator<Medic>(), health, ammo, range, power, team);
                 break;
             case SNIPER :
-                character = std::make_shared<Sniper>(health, ammo, range, power, team);
+                character = std::allocate_shared<Sniper>(PoolAllocator<Sniper>(), health, ammo, range, power, team);
                 break;
         }
         return character;
     }
 
-    shared_ptr<Character>Game::getCharacterAtCoordinates(const GridPoint& coordinates) {
-        return board.at(coordinates.row).at(coordinates.col);
+    Character* Game::getCharacterAtCoordinates(const GridPoint& coordinates) {
+        return board.getWritableCell(coordinates).get();
     }
 
-    shared_ptr<Character>Game::getCharacterAtCoordinates(const GridPoint &coordinates) const {
-        return board.at(coordinates.row).at(coordinates.col);
+    const Character* Game::getCharacterAtCoordinates(const GridPoint &coordinates) const {
+        return board.getCell(coordinates).get();
     }
 
     bool Game::areCoordinatesIllegal(const GridPoint& coordinates) const {
-        return (coordinates.row >= height || coordinates.col >= width || coordinates.row < 0 || coordinates.col < 0);
+        return (static_cast<unsigned int>(coordinates.row) >= static_cast<unsigned int>(height) ||
+                static_cast<unsigned int>(coordinates.col) >= static_cast<unsigned int>(width));
     }
 
     void Game::move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) {
+        throwIfFailed(tryMove(src_coordinates, dst_coordinates));
+    }
+
+    ActionStatus Game::checkMove(const GridPoint& src_coordinates, const GridPoint& dst_coordinates) const {
         if (areCoordinatesIllegal(src_coordinates) || areCoordinatesIllegal(dst_coordinates))
         {
-            throw IllegalCell();
+            return ACTION_ILLEGAL_CELL;
         }
-        if (isCellEmpty(src_coordinates))
+        const shared_ptr<Character>& character = board.getCell(src_coordinates);
+        if (character == nullptr)
         {
-            throw CellEmpty();
+            return ACTION_CELL_EMPTY;
         }
-        shared_ptr<Character> character = getCharacterAtCoordinates(src_coordinates);
         if (GridPoint::distance(src_coordinates, dst_coordinates) > character->getCharacterMovementRange())
         {
-            throw MoveTooFar();
+            return ACTION_MOVE_TOO_FAR;
         }
         if (!isCellEmpty(dst_coordinates))
         {
-            throw CellOccupied();
+            return ACTION_CELL_OCCUPIED;
         }
-        swap(board[src_coordinates.row][src_coordinates.col], board[dst_coordinates.row][dst_coordinates.col]);
+        return ACTION_SUCCESS;
     }
 
-    void Game::preAttackCheck(const GridPoint &src_coordinates, const GridPoint &dst_coordinates,
-                                   const shared_ptr<Character>& attacker_ptr, const shared_ptr<Character>& target_ptr)
-                                   const
+    ActionStatus Game::tryMove(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) {
+        GAME_INSTRUMENT_OPERATION(MOVE_OPERATION);
+        return executeMove(src_coordinates, dst_coordinates);
+    }
+
+    ActionStatus Game::executeMove(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) {
+        ActionStatus status = checkMove(src_coordinates, dst_coordinates);
+        if (status != ACTION_SUCCESS)
+        {
+            return status;
+        }
+        applyMove(src_coordinates, dst_coordinates);
+        if (journal != nullptr)
+        {
+            journal->recordMove(*this, src_coordinates, dst_coordinates);
+        }
+        return ACTION_SUCCESS;
+    }
+
+    ActionStatus Game::legalMoves(const GridPoint& coordinates, vector<GridPoint>& destinations) const {
+        destinations.clear();
+        if (areCoordinatesIllegal(coordinates))
+        {
+            return ACTION_ILLEGAL_CELL;
+        }
+        const Character* character = getCharacterAtCoordinates(coordinates);
+        if (character == nullptr)
+        {
+            return ACTION_CELL_EMPTY;
+        }
+        int radius = character->getCharacterMovementRange();
+        int first_row = std::max(0, coordinates.row - radius);
+        int last_row = std::min(height - 1, coordinates.row + radius);
+        for (int r = first_row; r <= last_row; r++)
+        {
+            int row_radius = radius - std::abs(r - coordinates.row);
+            int first_col = std::max(0, coordinates.col - row_radius);
+            int last_col = std::min(width - 1, coordinates.col + row_radius);
+            occupancy.forEachEmptyInRow(r, first_col, last_col, [&](int c) {
+                destinations.push_back(GridPoint(r, c));
+            });
+        }
+        return ACTION_SUCCESS;
+    }
+
+    ActionStatus Game::legalTargets(const GridPoint& coordinates, vector<GridPoint>& targets) const {
+        targets.clear();
+        if (areCoordinatesIllegal(coordinates))
+        {
+            return ACTION_ILLEGAL_CELL;
+        }
+        const Character* attacker = getCharacterAtCoordinates(coordinates);
+        if (attacker == nullptr)
+        {
+            return ACTION_CELL_EMPTY;
+        }
+        switch (attacker->getCharacterType()) {
+            case SOLDIER :
+                if (typeid(*attacker) == typeid(Soldier))
+                {
+                    collectLegalTargets(coordinates, static_cast<const Soldier&>(*attacker), targets);
+                    return ACTION_SUCCESS;
+                }
+                break;
+            case MEDIC :
+                if (typeid(*attacker) == typeid(Medic))
+                {
+                    collectLegalTargets(coordinates, static_cast<const Medic&>(*attacker), targets);
+                    return ACTION_SUCCESS;
+                }
+                break;
+            case SNIPER :
+                if (typeid(*attacker) == typeid(Sniper))
+                {
+                    collectLegalTargets(coordinates, static_cast<const Sniper&>(*attacker), targets);
+                    return ACTION_SUCCESS;
+                }
+                break;
+        }
+        collectLegalTargets(coordinates, *attacker, targets);
+        return ACTION_SUCCESS;
+    }
+
+    template <class AttackerType>
+    void Game::appendIfLegalTarget(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                   const AttackerType& attacker, vector<GridPoint>& targets) const
     {
-        if (isCellEmpty(src_coordinates))
+        if (preAttackCheck(src_coordinates, dst_coordinates, attacker, getCharacterAtCoordinates(dst_coordinates)) ==
+            ACTION_SUCCESS)
         {
-            throw CellEmpty();
+            targets.push_back(dst_coordinates);
         }
-        if (!(attacker_ptr->isTargetInStrikeRange(src_coordinates, dst_coordinates)))
+    }
+
+    void Game::collectLegalTargets(const GridPoint& src_coordinates, const Soldier& attacker,
+                                   vector<GridPoint>& targets) const {
+        if (!(attacker.isCharacterHasEnoughAmmo(nullptr)))
         {
-            throw OutOfRange();
+            return;
         }
-        if (!(attacker_ptr->isCharacterHasEnoughAmmo(target_ptr)))
+        int range = attacker.getCharacterRange();
+        int first_row = std::max(0, src_coordinates.row - range);
+        int last_row = std::min(height - 1, src_coordinates.row + range);
+        for (int r = first_row; r <= last_row; r++)
         {
-            throw OutOfAmmo();
+            if (r != src_coordinates.row)
+            {
+                appendIfLegalTarget(src_coordinates, GridPoint(r, src_coordinates.col), attacker, targets);
+                continue;
+            }
+            int first_col = std::max(0, src_coordinates.col - range);
+            int last_col = std::min(width - 1, src_coordinates.col + range);
+            for (int c = first_col; c <= last_col; c++)
+            {
+                appendIfLegalTarget(src_coordinates, GridPoint(r, c), attacker, targets);
+            }
+        }
+    }
+
+    void Game::collectLegalTargets(const GridPoint& src_coordinates, const Medic& attacker,
+                                   vector<GridPoint>& targets) const {
+        int range = attacker.getCharacterRange();
+        int first_row = std::max(0, src_coordinates.row - range);
+        int last_row = std::min(height - 1, src_coordinates.row + range);
+        for (int r = first_row; r <= last_row; r++)
+        {
+            int row_range = range - std::abs(r - src_coordinates.row);
+            int first_col = std::max(0, src_coordinates.col - row_range);
+            int last_col = std::min(width - 1, src_coordinates.col + row_range);
+            occupancy.forEachOccupiedInRow(r, first_col, last_col, [&](int c) {
+                appendIfLegalTarget(src_coordinates, GridPoint(r, c), attacker, targets);
+            });
+        }
+    }
+
+    void Game::collectLegalTargets(const GridPoint& src_coordinates, const Sniper& attacker,
+                                   vector<GridPoint>& targets) const {
+        if (!(attacker.isCharacterHasEnoughAmmo(nullptr)))
+        {
+            return;
+        }
+        int range = attacker.getCharacterRange();
+        int minimal_range = attacker.getCharacterMinimalStrikeRange();
+        int first_row = std::max(0, src_coordinates.row - range);
+        int last_row = std::min(height - 1, src_coordinates.row + range);
+        for (int r = first_row; r <= last_row; r++)
+        {
+            int row_distance = std::abs(r - src_coordinates.row);
+            int row_range = range - row_distance;
+            int row_gap = minimal_range - 1 - row_distance;
+            auto visitor = [&](int c) {
+                appendIfLegalTarget(src_coordinates, GridPoint(r, c), attacker, targets);
+            };
+            if (row_gap < 0)
+            {
+                occupancy.forEachOccupiedInRow(r, std::max(0, src_coordinates.col - row_range),
+                                               std::min(width - 1, src_coordinates.col + row_range), visitor);
+                continue;
+            }
+            occupancy.forEachOccupiedInRow(r, std::max(0, src_coordinates.col - row_range),
+                                           std::min(width - 1, src_coordinates.col - row_gap - 1), visitor);
+            occupancy.forEachOccupiedInRow(r, std::max(0, src_coordinates.col + row_gap + 1),
+                                           std::min(width - 1, src_coordinates.col + row_range), visitor);
+        }
+    }
+
+    void Game::collectLegalTargets(const GridPoint& src_coordinates, const Character& attacker,
+                                   vector<GridPoint>& targets) const {
+        for (int r = 0; r < height; r++)
+        {
+            for (int c = 0; c < width; c++)
+            {
+                appendIfLegalTarget(src_coordinates, GridPoint(r, c), attacker, targets);
+            }
+        }
+    }
+
+    void Game::applyMove(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) {
+        beginUndoRecord();
+        if (is_undo_enabled)
+        {
+            UndoEntry entry = {MOVE_BACK_ENTRY, dst_coordinates.row, dst_coordinates.col, src_coordinates.row,
+                               src_coordinates.col, 0, 0, 0, nullptr};
+            undo_entries.push_back(entry);
+        }
+        toggleCellHash(src_coordinates);
+        swap(board.getWritableCell(src_coordinates), board.getWritableCell(dst_coordinates));
+        occupancy.markEmpty(src_coordinates);
+        occupancy.markOccupied(dst_coordinates);
+        toggleCellHash(dst_coordinates);
+        startBoardVersion();
+        markCellChanged(src_coordinates);
+        markCellChanged(dst_coordinates);
+    }
+
+    template <class AttackerType>
+    ActionStatus Game::preAttackCheck(const GridPoint &src_coordinates, const GridPoint &dst_coordinates,
+                                      const AttackerType& attacker, const Character* target_ptr) const
+    {
+        if (!(attacker.isTargetInStrikeRange(src_coordinates, dst_coordinates)))
+        {
+            return ACTION_OUT_OF_RANGE;
+        }
+        if (!(attacker.isCharacterHasEnoughAmmo(target_ptr)))
+        {
+            return ACTION_OUT_OF_AMMO;
         }
-        if (!(attacker_ptr->isStrikeLegal(src_coordinates, dst_coordinates, target_ptr)))
+        if (!(attacker.isStrikeLegal(src_coordinates, dst_coordinates, target_ptr)))
         {
-            throw IllegalTarget();
+            return ACTION_ILLEGAL_TARGET;
         }
+        return ACTION_SUCCESS;
     }
 
     void Game::attack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) {
+        throwIfFailed(tryAttack(src_coordinates, dst_coordinates));
+    }
+
+    ActionStatus Game::tryAttack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) {
+        GAME_INSTRUMENT_OPERATION(ATTACK_OPERATION);
+        return executeAttack(src_coordinates, dst_coordinates);
+    }
+
+    ActionStatus Game::executeAttack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) {
         if (areCoordinatesIllegal(src_coordinates) || areCoordinatesIllegal(dst_coordinates))
         {
-            throw IllegalCell();
+            return ACTION_ILLEGAL_CELL;
         }
-        shared_ptr<Character> attacker_ptr = getCharacterAtCoordinates(src_coordinates);
-        shared_ptr<Character> target_ptr = getCharacterAtCoordinates(dst_coordinates);
-        preAttackCheck(src_coordinates, dst_coordinates, attacker_ptr, target_ptr);
-        for (int r = 0; r < height ; r++)
+        if (isCellEmpty(src_coordinates))
         {
-            for (int c = 0; c < width; c++)
+            return ACTION_CELL_EMPTY;
+        }
+        ActionStatus status = dispatchAttack(src_coordinates, dst_coordinates, true);
+        if (status == ACTION_SUCCESS && journal != nullptr)
+        {
+            journal->recordAttack(*this, src_coordinates, dst_coordinates);
+        }
+        return status;
+    }
+
+    ActionStatus Game::dispatchAttack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates,
+                                      bool check_attack)
+    {
+        const Character& attacker = *board.getCell(src_coordinates);
+        switch (attacker.getCharacterType()) {
+            case SOLDIER :
+                if (typeid(attacker) == typeid(Soldier))
+                {
+                    return performAttack(src_coordinates, dst_coordinates, static_cast<const Soldier&>(attacker),
+                                         check_attack);
+                }
+                break;
+            case MEDIC :
+                if (typeid(attacker) == typeid(Medic))
+                {
+                    return performAttack(src_coordinates, dst_coordinates, static_cast<const Medic&>(attacker),
+                                         check_attack);
+                }
+                break;
+            case SNIPER :
+                if (typeid(attacker) == typeid(Sniper))
+                {
+                    return performAttack(src_coordinates, dst_coordinates, static_cast<const Sniper&>(attacker),
+                                         check_attack);
+                }
+                break;
+        }
+        return performAttack(src_coordinates, dst_coordinates, attacker, check_attack);
+    }
+
+    template <class AttackerType>
+    int Game::getStrikeAreaRadius(const AttackerType& attacker) const {
+        return std::min<units_t>(attacker.getCharacterStrikeAreaRadius(), height + width);
+    }
+
+    template <class AttackerType>
+    ActionStatus Game::performAttack(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                     const AttackerType& shared_attacker, bool check_attack)
+    {
+        if (check_attack)
+        {
+            ActionStatus status = preAttackCheck(src_coordinates, dst_coordinates, shared_attacker,
+                                                 board.getCell(dst_coordinates).get());
+            if (status != ACTION_SUCCESS)
             {
-                GridPoint current_coordinates = GridPoint(r, c);
-                shared_ptr<Character> current_target_ptr = board[r][c];
-                units_t strike_result = attacker_ptr->performStrike(src_coordinates, dst_coordinates,
-                                                                current_coordinates, current_target_ptr);
-                if (strike_result != 0)
+                return status;
+            }
+        }
+        AttackerType& attacker = static_cast<AttackerType&>(*getCharacterAtCoordinates(src_coordinates));
+        GAME_INSTRUMENT_COUNT(PERFORMED_ATTACKS_COUNTER, 1);
+        beginUndoRecord();
+        if (is_undo_enabled)
+        {
+            undo_entries.push_back(makeRestoreCellEntry(src_coordinates, attacker));
+        }
+        toggleCellHash(src_coordinates);
+        startBoardVersion();
+        markCellChanged(src_coordinates);
+        performStrikeOnCell(src_coordinates, dst_coordinates, dst_coordinates, attacker, live_units_per_team,
+                            change_log, getUndoLog(), position_hash);
+        int radius = getStrikeAreaRadius(attacker);
+        int first_row = std::max(0, dst_coordinates.row - radius);
+        int last_row = std::min(height - 1, dst_coordinates.row + radius);
+        long long area_cells = static_cast<long long>(last_row - first_row + 1) * std::min(width, 2 * radius + 1);
+        if (strike_threads > 1 && area_cells >= PARALLEL_STRIKE_MIN_CELLS)
+        {
+            performParallelAreaStrike(src_coordinates, dst_coordinates, attacker, first_row, last_row,
+                                      strike_threads);
+        }
+        else
+        {
+            performAreaStrike(src_coordinates, dst_coordinates, attacker, first_row, last_row, live_units_per_team,
+                              change_log, getUndoLog(), position_hash);
+        }
+        toggleCellHash(src_coordinates);
+        checkLiveUnitsCounters();
+        return ACTION_SUCCESS;
+    }
+
+    template <class AttackerType>
+    void Game::performAreaStrike(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                 AttackerType& attacker, int first_row, int last_row,
+                                 std::array<int, NUM_OF_TEAMS>& live_units, vector<CellChange>& changes,
+                                 vector<UndoEntry>* undo_log, uint64_t& hash)
+    {
+        int radius = getStrikeAreaRadius(attacker);
+        for (int r = first_row; r <= last_row; r++)
+        {
+            int row_radius = radius - std::abs(r - dst_coordinates.row);
+            int first_col = std::max(0, dst_coordinates.col - row_radius);
+            int last_col = std::min(width - 1, dst_coordinates.col + row_radius);
+            occupancy.forEachOccupiedInRow(r, first_col, last_col, [&](int c) {
+                GridPoint current_coordinates(r, c);
+                if (!(current_coordinates == dst_coordinates))
                 {
-                    current_target_ptr->setCharacterHealthPoints(strike_result);
-                    if (!(current_target_ptr->isCharacterAlive()))
-                    {
-                        board[r][c] = nullptr;
-                    }
+                    performStrikeOnCell(src_coordinates, dst_coordinates, current_coordinates, attacker, live_units,
+                                        changes, undo_log, hash);
                 }
+            });
+        }
+    }
+
+    template <class AttackerType>
+    void Game::performParallelAreaStrike(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                         AttackerType& attacker, int first_row, int last_row, int num_of_threads)
+    {
+        int tile_side = TiledBoard::getTileSide();
+        int first_tile_row = first_row / tile_side;
+        int num_of_tile_rows = last_row / tile_side - first_tile_row + 1;
+        int num_of_bands = std::min(num_of_threads, num_of_tile_rows);
+        vector<std::array<int, NUM_OF_TEAMS>> band_live_units(num_of_bands, std::array<int, NUM_OF_TEAMS>());
+        vector<vector<CellChange>> band_changes(num_of_bands);
+        vector<vector<UndoEntry>> band_undo_logs(num_of_bands);
+        vector<uint64_t> band_hashes(num_of_bands, 0);
+        vector<std::exception_ptr> band_errors(num_of_bands);
+        auto strike_band = [&](int band) {
+            int band_first_row = std::max(first_row, (first_tile_row + band * num_of_tile_rows / num_of_bands) *
+                                                     tile_side);
+            int band_last_row = std::min(last_row, (first_tile_row + (band + 1) * num_of_tile_rows / num_of_bands) *
+                                                   tile_side - 1);
+            try
+            {
+                performAreaStrike(src_coordinates, dst_coordinates, attacker, band_first_row, band_last_row,
+                                  band_live_units[band], band_changes[band],
+                                  is_undo_enabled ? &band_undo_logs[band] : nullptr, band_hashes[band]);
+            }
+            catch (...)
+            {
+                band_errors[band] = std::current_exception();
+            }
+        };
+        vector<std::thread> threads;
+        for (int band = 1; band < num_of_bands; band++)
+        {
+            threads.push_back(std::thread(strike_band, band));
+        }
+        strike_band(0);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        for (int band = 0; band < num_of_bands; band++)
+        {
+            for (int team = 0; team < NUM_OF_TEAMS; team++)
+            {
+                live_units_per_team[team] += band_live_units[band][team];
+            }
+            position_hash ^= band_hashes[band];
+            change_log.insert(change_log.end(), band_changes[band].begin(), band_changes[band].end());
+            undo_entries.insert(undo_entries.end(), std::make_move_iterator(band_undo_logs[band].begin()),
+                                std::make_move_iterator(band_undo_logs[band].end()));
+        }
+        for (int band = 0; band < num_of_bands; band++)
+        {
+            if (band_errors[band])
+            {
+                std::rethrow_exception(band_errors[band]);
+            }
+        }
+    }
+
+    template <class AttackerType>
+    void Game::performStrikeOnCell(const GridPoint& src_coordinates, const GridPoint& main_target_coordinates,
+                                   const GridPoint& current_target_coordinates, AttackerType& attacker,
+                                   std::array<int, NUM_OF_TEAMS>& live_units, vector<CellChange>& changes,
+                                   vector<UndoEntry>* undo_log, uint64_t& hash)
+    {
+        GAME_INSTRUMENT_COUNT(CELLS_VISITED_COUNTER, 1);
+        GAME_INSTRUMENT_COUNT(VIRTUAL_STRIKE_CALLS_COUNTER, (std::is_same<AttackerType, Character>::value ? 1 : 0));
+        units_t strike_result = attacker.performStrike(src_coordinates, main_target_coordinates,
+                                                       current_target_coordinates,
+                                                       board.getCell(current_target_coordinates).get());
+        if (strike_result != 0)
+        {
+            shared_ptr<Character>& current_target_ptr = board.getWritableCell(current_target_coordinates);
+            if (undo_log != nullptr)
+            {
+                undo_log->push_back(makeRestoreCellEntry(current_target_coordinates, *current_target_ptr));
+            }
+            hash ^= ZobristHash::getCharacterKey(current_target_coordinates, *current_target_ptr);
+            current_target_ptr->setCharacterHealthPoints(strike_result);
+            CellChange change = {board_version, current_target_coordinates.row, current_target_coordinates.col};
+            changes.push_back(change);
+            if (current_target_ptr->isCharacterAlive())
+            {
+                hash ^= ZobristHash::getCharacterKey(current_target_coordinates, *current_target_ptr);
+            }
+            else
+            {
+                GAME_INSTRUMENT_COUNT(UNITS_KILLED_COUNTER, 1);
+                live_units[current_target_ptr->getCharacterTeam()]--;
+                if (undo_log != nullptr)
+                {
+                    undo_log->back().removed_character = std::move(current_target_ptr);
+                }
+                current_target_ptr = nullptr;
+                occupancy.markEmpty(current_target_coordinates);
             }
         }
     }
 
     void Game::reload(const GridPoint &coordinates) {
+        throwIfFailed(tryReload(coordinates));
+    }
+
+    ActionStatus Game::tryReload(const GridPoint &coordinates) {
+        GAME_INSTRUMENT_OPERATION(RELOAD_OPERATION);
+        return executeReload(coordinates);
+    }
+
+    ActionStatus Game::executeReload(const GridPoint &coordinates) {
         if (areCoordinatesIllegal(coordinates))
         {
-            throw IllegalCell();
+            return ACTION_ILLEGAL_CELL;
         }
         if (isCellEmpty(coordinates))
         {
-            throw CellEmpty();
+            return ACTION_CELL_EMPTY;
+        }
+        applyReload(coordinates);
+        if (journal != nullptr)
+        {
+            journal->recordReload(*this, coordinates);
         }
-        shared_ptr<Character> character = getCharacterAtCoordinates(coordinates);
+        return ACTION_SUCCESS;
+    }
+
+    void Game::applyReload(const GridPoint &coordinates) {
+        Character* character = getCharacterAtCoordinates(coordinates);
+        beginUndoRecord();
+        if (is_undo_enabled)
+        {
+            undo_entries.push_back(makeRestoreCellEntry(coordinates, *character));
+        }
+        toggleCellHash(coordinates);
         character->setCharacterAmmo(character->getCharacterReloadAmmoAddition());
+        toggleCellHash(coordinates);
+        startBoardVersion();
+        markCellChanged(coordinates);
     }
 
-    std::ostream& operator<<(std::ostream &os, const Game& game) {
-        string output_str = string();
-        for (int r = 0; r < game.height ; r++)
+    void Game::setJournal(ActionJournal* journal) {
+        this->journal = journal;
+    }
+
+    void Game::setUndoEnabled(bool is_enabled) {
+        is_undo_enabled = is_enabled;
+        if (!is_enabled)
+        {
+            undo_entries.clear();
+            undo_frames.clear();
+        }
+    }
+
+    void Game::toggleCellHash(const GridPoint& coordinates) {
+        const Character* character = board.getCell(coordinates).get();
+        if (character != nullptr)
+        {
+            position_hash ^= ZobristHash::getCharacterKey(coordinates, *character);
+        }
+    }
+
+    uint64_t Game::getPositionHash() const {
+        return position_hash;
+    }
+
+    vector<Game::UndoEntry>* Game::getUndoLog() {
+        return is_undo_enabled ? &undo_entries : nullptr;
+    }
+
+    void Game::beginUndoRecord() {
+        if (is_undo_enabled && !(is_in_batch && is_batch_recorded))
         {
-            for (int c = 0; c < game.width; c++)
+            undo_frames.push_back(undo_entries.size());
+        }
+    }
+
+    Game::UndoEntry Game::makeRestoreCellEntry(const GridPoint& coordinates, const Character& character) {
+        UndoEntry entry = {RESTORE_CELL_ENTRY, coordinates.row, coordinates.col, 0, 0,
+                           character.getCharacterHealthPoints(), character.getCharacterAmmo(),
+                           character.getSuccessfulStrikesCounter(), nullptr};
+        return entry;
+    }
+
+    void Game::revertUndoEntry(UndoEntry& entry) {
+        GridPoint coordinates(entry.row, entry.col);
+        shared_ptr<Character>& cell = board.getWritableCell(coordinates);
+        markCellChanged(coordinates);
+        toggleCellHash(coordinates);
+        switch (entry.type) {
+            case MOVE_BACK_ENTRY :
             {
-                GridPoint coordinate(r,c);
-                if (game.isCellEmpty(coordinate))
+                GridPoint source_coordinates(entry.source_row, entry.source_col);
+                swap(cell, board.getWritableCell(source_coordinates));
+                occupancy.markEmpty(coordinates);
+                occupancy.markOccupied(source_coordinates);
+                markCellChanged(source_coordinates);
+                toggleCellHash(source_coordinates);
+                return;
+            }
+            case REMOVE_ADDED_ENTRY :
+                live_units_per_team[cell->getCharacterTeam()]--;
+                cell = nullptr;
+                occupancy.markEmpty(coordinates);
+                return;
+            case RESTORE_CELL_ENTRY :
+                if (entry.removed_character != nullptr)
                 {
-                    output_str += " " ;
+                    cell = std::move(entry.removed_character);
+                    occupancy.markOccupied(coordinates);
+                    live_units_per_team[cell->getCharacterTeam()]++;
                 }
-                else
-                {
-                    output_str += game.board[r][c]->getCharacterIdentifierChar();
+                cell->setCharacterHealthPoints(entry.health_points - cell->getCharacterHealthPoints());
+                cell->setCharacterAmmo(entry.ammo_points - cell->getCharacterAmmo());
+                cell->setSuccessfulStrikesCounter(entry.successful_strikes_counter);
+                toggleCellHash(coordinates);
+                return;
+        }
+    }
+
+    bool Game::undo() {
+        if (undo_frames.empty())
+        {
+            return false;
+        }
+        startBoardVersion();
+        size_t first_entry = undo_frames.back();
+        undo_frames.pop_back();
+        while (undo_entries.size() > first_entry)
+        {
+            revertUndoEntry(undo_entries.back());
+            undo_entries.pop_back();
+        }
+        checkLiveUnitsCounters();
+        if (journal != nullptr)
+        {
+            journal->recordCheckpoint(*this);
+        }
+        return true;
+    }
+
+    void Game::setStrikeThreads(int num_of_threads) {
+        if (num_of_threads < 0)
+        {
+            throw IllegalArgument();
+        }
+        if (num_of_threads == 0)
+        {
+            num_of_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        strike_threads = num_of_threads;
+    }
+
+    ActionStatus Game::tryAction(const Action& action) {
+        switch (action.type) {
+            case MOVE_ACTION :
+                return tryMove(action.src_coordinates, action.dst_coordinates);
+            case ATTACK_ACTION :
+                return tryAttack(action.src_coordinates, action.dst_coordinates);
+            case RELOAD_ACTION :
+            default :
+                return tryReload(action.src_coordinates);
+        }
+    }
+
+    void Game::applyBatch(const vector<Action>& actions, vector<ActionStatus>& results) {
+        GAME_INSTRUMENT_OPERATION(BATCH_OPERATION);
+        results.resize(actions.size());
+        is_in_batch = true;
+        is_batch_recorded = false;
+        try
+        {
+            for (size_t i = 0; i < actions.size(); i++)
+            {
+                const Action& action = actions[i];
+                switch (action.type) {
+                    case MOVE_ACTION :
+                        results[i] = executeMove(action.src_coordinates, action.dst_coordinates);
+                        break;
+                    case ATTACK_ACTION :
+                        results[i] = executeAttack(action.src_coordinates, action.dst_coordinates);
+                        break;
+                    case RELOAD_ACTION :
+                    default :
+                        results[i] = executeReload(action.src_coordinates);
+                        break;
                 }
             }
         }
-        const char *begin = output_str.c_str();
-        const char *end = begin + strlen(begin);
-        printGameBoard(os, begin, end, game.width);
+        catch (...)
+        {
+            is_in_batch = false;
+            throw;
+        }
+        is_in_batch = false;
+    }
+
+    void Game::throwIfFailed(ActionStatus status) {
+        if (status != ACTION_SUCCESS)
+        {
+            GAME_INSTRUMENT_EXCEPTION(status);
+        }
+        switch (status) {
+            case ACTION_SUCCESS :
+                return;
+            case ACTION_ILLEGAL_CELL :
+                throw IllegalCell();
+            case ACTION_CELL_EMPTY :
+                throw CellEmpty();
+            case ACTION_MOVE_TOO_FAR :
+                throw MoveTooFar();
+            case ACTION_CELL_OCCUPIED :
+                throw CellOccupied();
+            case ACTION_OUT_OF_RANGE :
+                throw OutOfRange();
+            case ACTION_OUT_OF_AMMO :
+                throw OutOfAmmo();
+            case ACTION_ILLEGAL_TARGET :
+                throw IllegalTarget();
+        }
+    }
+
+    std::ostream& operator<<(std::ostream &os, const Game& game) {
+        GAME_INSTRUMENT_OPERATION(PRINT_OPERATION);
+        game.printBoardRegion(os, GridPoint(0, 0), game.height, game.width);
         return os;
     }
 
+    void Game::printBoardRegion(std::ostream& os, const GridPoint& top_left, int num_of_rows, int num_of_cols)
+    const
+    {
+        if (num_of_rows <= 0 || num_of_cols <= 0)
+        {
+            throw IllegalArgument();
+        }
+        if (areCoordinatesIllegal(top_left) || num_of_rows > height - top_left.row ||
+            num_of_cols > width - top_left.col)
+        {
+            throw IllegalCell();
+        }
+        GridPoint bottom_right(top_left.row + num_of_rows - 1, top_left.col + num_of_cols - 1);
+        char buffer[2 * RENDER_CHUNK_CELLS];
+        printRepeatedChar(os, buffer, BORDER_CHAR, 2 * num_of_cols + 1);
+        os.put('\n');
+        for (int r = top_left.row; r <= bottom_right.row; r++)
+        {
+            for (int first_col = top_left.col; first_col <= bottom_right.col; first_col += RENDER_CHUNK_CELLS)
+            {
+                int last_col = std::min(bottom_right.col, first_col + RENDER_CHUNK_CELLS - 1);
+                int num_of_cells = last_col - first_col + 1;
+                for (int i = 0; i < num_of_cells; i++)
+                {
+                    buffer[2 * i] = CELL_SEPARATOR_CHAR;
+                    buffer[2 * i + 1] = EMPTY_CELL_CHAR;
+                }
+                occupancy.forEachOccupiedInRow(r, first_col, last_col, [&](int c) {
+                    buffer[2 * (c - first_col) + 1] = board.getCell(GridPoint(r, c))->getCharacterIdentifierChar();
+                });
+                os.write(buffer, 2 * num_of_cells);
+            }
+            os.put(CELL_SEPARATOR_CHAR);
+            os.put('\n');
+        }
+        printRepeatedChar(os, buffer, BORDER_CHAR, 2 * num_of_cols + 1);
+    }
+
+    void Game::printRepeatedChar(std::ostream& os, char* buffer, char c, int count) {
+        std::fill(buffer, buffer + std::min(count, RENDER_CHUNK_CELLS), c);
+        while (count > 0)
+        {
+            int chunk_size = std::min(count, RENDER_CHUNK_CELLS);
+            os.write(buffer, chunk_size);
+            count -= chunk_size;
+        }
+    }
+
     bool Game::isOver(Team *winningTeam) const {
-        bool no_players_alive = true;
-        Team potential_winning_team;
-        for (int r = 0; r < height ; r++)
+        int powerlifters_alive = live_units_per_team[POWERLIFTERS];
+        int crossfitters_alive = live_units_per_team[CROSSFITTERS];
+        if (powerlifters_alive > 0 && crossfitters_alive > 0)
+        {
+            return false;
+        }
+        bool no_players_alive = (powerlifters_alive == 0 && crossfitters_alive == 0);
+        Team potential_winning_team = (powerlifters_alive > 0) ? POWERLIFTERS : CROSSFITTERS;
+        return isOverReturnResult(winningTeam, no_players_alive, potential_winning_team);
+    }
+
+    void Game::startBoardVersion() {
+        if (is_in_batch)
+        {
+            if (is_batch_recorded)
+            {
+                return;
+            }
+            is_batch_recorded = true;
+        }
+        board_version++;
+        if (change_log.size() < MAX_CHANGE_LOG_SIZE)
+        {
+            return;
+        }
+        unsigned long long dropped_version = change_log[change_log.size() / 2].version;
+        vector<CellChange>::iterator first_kept = change_log.begin() + change_log.size() / 2;
+        while (first_kept != change_log.end() && first_kept->version <= dropped_version)
+        {
+            ++first_kept;
+        }
+        change_log.erase(change_log.begin(), first_kept);
+        change_log_base_version = dropped_version;
+    }
+
+    void Game::markCellChanged(const GridPoint& coordinates) {
+        CellChange change = {board_version, coordinates.row, coordinates.col};
+        change_log.push_back(change);
+    }
+
+    unsigned long long Game::getBoardVersion() const {
+        return board_version;
+    }
+
+    bool Game::getBoardChanges(unsigned long long since_version, vector<CellUpdate>& updates) const {
+        updates.clear();
+        if (since_version < change_log_base_version || since_version > board_version)
+        {
+            return false;
+        }
+        vector<int64_t> changed_cells;
+        for (vector<CellChange>::const_reverse_iterator it = change_log.rbegin();
+             it != change_log.rend() && it->version > since_version; ++it)
+        {
+            changed_cells.push_back(static_cast<int64_t>(it->row) * width + it->col);
+        }
+        std::sort(changed_cells.begin(), changed_cells.end());
+        changed_cells.erase(std::unique(changed_cells.begin(), changed_cells.end()), changed_cells.end());
+        updates.reserve(changed_cells.size());
+        for (int64_t cell : changed_cells)
+        {
+            GridPoint coordinates(static_cast<int>(cell / width), static_cast<int>(cell % width));
+            const shared_ptr<Character>& character = board.getCell(coordinates);
+            updates.push_back(CellUpdate(coordinates, (character == nullptr) ? EMPTY_CELL_CHAR :
+                                                      character->getCharacterIdentifierChar()));
+        }
+        return true;
+    }
+
+    void Game::exportUnits(UnitStore& store) const {
+        store.reserve(store.getSize() + live_units_per_team[POWERLIFTERS] + live_units_per_team[CROSSFITTERS]);
+        for (int r = 0; r < height; r++)
+        {
+            occupancy.forEachOccupiedInRow(r, 0, width - 1, [&](int c) {
+                GridPoint coordinates(r, c);
+                store.addUnit(coordinates, *board.getCell(coordinates));
+            });
+        }
+    }
+
+    const Character* Game::getCharacter(const GridPoint& coordinates) const {
+        if (areCoordinatesIllegal(coordinates))
+        {
+            GAME_INSTRUMENT_EXCEPTION(ACTION_ILLEGAL_CELL);
+            throw IllegalCell();
+        }
+        return board.getCell(coordinates).get();
+    }
+
+    bool Game::areLiveUnitsCountersConsistent() const {
+        std::array<int, NUM_OF_TEAMS> counted_units = std::array<int, NUM_OF_TEAMS>();
+        for (int r = 0; r < height; r++)
         {
             for (int c = 0; c < width; c++)
             {
-                GridPoint current_coordinates(r,c);
-                if(!isCellEmpty(current_coordinates))
+                const shared_ptr<Character>& character = board.getCell(GridPoint(r, c));
+                if (character != nullptr)
                 {
-                    if (no_players_alive)
-                    {
-                        potential_winning_team = board[r][c]->getCharacterTeam();
-                        no_players_alive = false;
-                    }
-                    else
-                    {
-                        if (potential_winning_team != board[r][c]->getCharacterTeam())
-                        {
-                            return false;
-                        }
-                    }
+                    counted_units[character->getCharacterTeam()]++;
                 }
             }
         }
-        return isOverReturnResult(winningTeam, no_players_alive, potential_winning_team);
+        return (counted_units == live_units_per_team);
+    }
+
+    void Game::checkLiveUnitsCounters() const {
+        assert(board_version % std::max(1LL, static_cast<long long>(height) * width / LIVE_UNITS_CHECK_CELLS_PER_ACTION)
+               != 0 || areLiveUnitsCountersConsistent());
     }
 
     bool Game::isOverReturnResult(Team *winningTeam, bool no_players_alive, Team potential_winning_team)
@@ -1,22 +1,119 @@
 #ifndef GAME_PROJECT_GAME_H
 #define GAME_PROJECT_GAME_H
 #include <vector>
+#include <array>
+#include <cstdint>
 #include "Character.h"
 #include "Exceptions.h"
+#include "OccupancyIndex.h"
+#include "TiledBoard.h"
+#include "UnitStore.h"
+#include "Action.h"
 #include "Auxiliaries.h"
 #include <iostream>
 
 namespace mtm
 {
+    class ActionJournal;
+    class Soldier;
+    class Medic;
+    class Sniper;
+
+    /**
+    * struct CellUpdate:
+    *      the current content of a board cell that changed, as it is printed by operator<<.
+    */
+    struct CellUpdate {
+        GridPoint coordinates;
+        char identifier_char;
+
+        /**
+        * constructor of the update that receives 2 parameters.
+        * @param coordinates : the coordinates of the cell.
+        * @param identifier_char : the char of the character in the cell, or ' ' if the cell is empty.
+        */
+        CellUpdate(const GridPoint& coordinates, char identifier_char) :
+                coordinates(coordinates), identifier_char(identifier_char)
+        {}
+    };
+
     /**
     * class Game
     * represents the whole game.
+    * when compiled with GAME_ENABLE_INSTRUMENTATION, the try methods, copying and printing are counted and timed,
+    * and so are the cells and kills of every attack. see Instrumentation.
     */
     class Game {
     private:
+        static const int NUM_OF_TEAMS = 2;
+        static const int RENDER_CHUNK_CELLS = 1024;
+        static const size_t MAX_CHANGE_LOG_SIZE;
+        static const long long LIVE_UNITS_CHECK_CELLS_PER_ACTION;
+        static const long long PARALLEL_STRIKE_MIN_CELLS;
+        static const char EMPTY_CELL_CHAR;
+        static const char CELL_SEPARATOR_CHAR;
+        static const char BORDER_CHAR;
         int height;
         int width;
-        std::vector<std::vector<std::shared_ptr<Character>>> board;
+        TiledBoard board;
+        OccupancyIndex occupancy;
+        std::array<int, NUM_OF_TEAMS> live_units_per_team;
+
+        /**
+        * struct CellChange:
+        *      an entry of the change log - a cell that was modified by the action of a given board version.
+        */
+        struct CellChange {
+            unsigned long long version;
+            int row;
+            int col;
+        };
+        unsigned long long board_version;
+        unsigned long long change_log_base_version;
+        std::vector<CellChange> change_log;
+        ActionJournal* journal;
+        int strike_threads;
+        uint64_t position_hash;
+
+        /**
+        * enum UndoEntryType:
+        *      the ways an undo entry reverts a cell.
+        */
+        enum UndoEntryType { RESTORE_CELL_ENTRY, MOVE_BACK_ENTRY, REMOVE_ADDED_ENTRY };
+        /**
+        * struct UndoEntry:
+        *      the previous state of a cell that an action modified.
+        *      a restore entry keeps the health, ammo and strikes counter of the character at the cell, and the
+        *      character itself if it died, so it can be put back without allocating. a move back entry moves the
+        *      character at the cell back to the source cell. a remove added entry empties the cell.
+        */
+        struct UndoEntry {
+            UndoEntryType type;
+            int row;
+            int col;
+            int source_row;
+            int source_col;
+            units_t health_points;
+            units_t ammo_points;
+            int successful_strikes_counter;
+            std::shared_ptr<Character> removed_character;
+        };
+        bool is_undo_enabled;
+        std::vector<UndoEntry> undo_entries;
+        std::vector<size_t> undo_frames;
+        bool is_in_batch;
+        bool is_batch_recorded;
+
+        friend class GameSnapshot;
+        friend class ActionJournal;
+
+        /**
+        * Copy Constructor that receives 2 parameters.
+        * @param other : the game to copy.
+        * @param share_tiles : true to share the board tiles of the other game until one of the games writes to
+        * them, false to clone every character of the other game right away.
+        */
+        Game(const Game& other, bool share_tiles);
 
         /**
         * isCellEmpty: checks if the cell in a given coordinates is empty.
@@ -25,17 +122,20 @@ namespace mtm
         */
         bool isCellEmpty(const GridPoint& coordinates) const;
         /**
-        * getCharacterAtCoordinates: get shared ptr to the character at the given coordinates.
+        * getCharacterAtCoordinates: borrows the character at the given coordinates, in order to modify it.
+        * if the character is shared with a forked game it is copied first.
+        * the pointer is owned by the board and is valid until the cell is modified.
         * @param coordinates : coordinates to get the character at.
-        * @return shared ptr to the character.
+        * @return pointer to the character, or null if the cell is empty.
         */
-        std::shared_ptr<Character> getCharacterAtCoordinates(const GridPoint& coordinates);
+        Character* getCharacterAtCoordinates(const GridPoint& coordinates);
         /**
-        * getCharacterAtCoordinates: get shared ptr to the character at the given coordinates.
+        * getCharacterAtCoordinates: borrows the character at the given coordinates.
+        * the pointer is owned by the board and is valid until the cell is modified.
         * @param coordinates : coordinates to get the character at.
-        * @return shared ptr to the character.
+        * @return pointer to the character, or null if the cell is empty.
         */
-        std::shared_ptr<Character> getCharacterAtCoordinates(const GridPoint& coordinates) const;
+        const Character* getCharacterAtCoordinates(const GridPoint& coordinates) const;
         /**
         * areCoordinatesIllegal : checks if the given coordinates are out of the game's board
         * @param coordinates : coordinates to check.
@@ -44,14 +144,260 @@ namespace mtm
         bool areCoordinatesIllegal(const GridPoint& coordinates) const;
         /**
         * preAttackCheck : performs pre check attack - checks if the attack can be taken place.
+        * @return ACTION_SUCCESS if the attack can be performed, otherwise the reason it cannot.
         * @param src_coordinates : coordinates of the attacker.
         * @param dst_coordinates : coordinates of the target.
-        * @param attacker_ptr : pointer to the attacker.
+        * @param attacker : the attacker. its static type selects the strike methods that are called.
         * @param target_ptr : pointer to the target.
         */
-        void preAttackCheck(const mtm::GridPoint &src_coordinates, const mtm::GridPoint &dst_coordinates,
-                            const std::shared_ptr<Character>& attacker_ptr,
-                            const std::shared_ptr<Character>&target_ptr) const;
+        template <class AttackerType>
+        ActionStatus preAttackCheck(const mtm::GridPoint &src_coordinates, const mtm::GridPoint &dst_coordinates,
+                                    const AttackerType& attacker, const Character* target_ptr) const;
+        /**
+        * performAttack: checks and performs the attack of the attacker over the main target and its strike area.
+        * instantiated for each of the built in character types, so the strike methods of the attacker can be
+        * called without virtual dispatch, and for Character as a fallback for other character classes.
+        * the attack is checked on the attacker as it is read from the board, and the tile of the attacker is only
+        * made writable - copied if it is shared with a forked game - once the attack is known to be legal.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param dst_coordinates : coordinates of the main target.
+        * @param shared_attacker : the attacker as it is read from the board. its exact class must be AttackerType.
+        * @param check_attack : false to skip the range, ammo and target checks of an attack that is known to be
+        * legal.
+        * @return ACTION_SUCCESS if the attack was performed, otherwise the reason it could not be performed.
+        */
+        template <class AttackerType>
+        ActionStatus performAttack(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                   const AttackerType& shared_attacker, bool check_attack);
+        /**
+        * dispatchAttack: performs the attack of the character at the src coordinates through the performAttack
+        * instantiation of its exact type.
+        * @param src_coordinates : coordinates of the attacker, must contain a character.
+        * @param dst_coordinates : coordinates of the main target, must be inside the board.
+        * @param check_attack : false to skip the range, ammo and target checks of an attack that is known to be
+        * legal.
+        * @return ACTION_SUCCESS if the attack was performed, otherwise the reason it could not be performed.
+        */
+        ActionStatus dispatchAttack(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                    bool check_attack);
+        /**
+        * checkMove: checks if a move can be performed, with the checks of tryMove.
+        * @param src_coordinates : the coordinates of the character to move.
+        * @param dst_coordinates : the coordinates to move the character to.
+        * @return ACTION_SUCCESS if the move can be performed, otherwise the reason it cannot.
+        */
+        ActionStatus checkMove(const GridPoint& src_coordinates, const GridPoint& dst_coordinates) const;
+        /**
+        * executeMove, executeAttack, executeReload: the bodies of tryMove, tryAttack and tryReload, without their
+        * instrumentation scope, so applyBatch can time the whole batch as one operation.
+        * @return ACTION_SUCCESS if the action was performed, otherwise the reason it could not be performed.
+        */
+        ActionStatus executeMove(const GridPoint& src_coordinates, const GridPoint& dst_coordinates);
+        ActionStatus executeAttack(const GridPoint& src_coordinates, const GridPoint& dst_coordinates);
+        ActionStatus executeReload(const GridPoint& coordinates);
+        /**
+        * applyAddCharacter: adds a character to an empty cell without checking it and records the change.
+        * @param coordinates : the coordinates of an empty cell inside the board.
+        * @param character : the character to add.
+        */
+        void applyAddCharacter(const GridPoint& coordinates, const std::shared_ptr<Character>& character);
+        /**
+        * applyMove: moves a character without checking the move and records the change.
+        * @param src_coordinates : the coordinates of the character.
+        * @param dst_coordinates : the coordinates of an empty cell to move the character to.
+        */
+        void applyMove(const GridPoint& src_coordinates, const GridPoint& dst_coordinates);
+        /**
+        * applyReload: reloads a character without checking the cell and records the change.
+        * @param coordinates : the coordinates of the character.
+        */
+        void applyReload(const GridPoint& coordinates);
+        /**
+        * performStrikeOnCell: performs the strike of the attacker on a single cell of the board and removes the
+        * character at the cell from the board if it died as a result of the strike.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param main_target_coordinates : coordinates of the main target of the attack.
+        * @param current_target_coordinates : coordinates of the cell to strike.
+        * @param attacker : the attacker.
+        * @param live_units : the live units counters to decrease when the character at the cell dies.
+        * @param changes : the change log to record the cell in if it was modified.
+        * @param undo_log : the undo entries to record the previous state of the cell in, or null if undo is
+        * disabled.
+        * @param hash : the position hash to xor the keys of the previous and new states of the cell into.
+        */
+        template <class AttackerType>
+        void performStrikeOnCell(const GridPoint& src_coordinates, const GridPoint& main_target_coordinates,
+                                 const GridPoint& current_target_coordinates, AttackerType& attacker,
+                                 std::array<int, NUM_OF_TEAMS>& live_units, std::vector<CellChange>& changes,
+                                 std::vector<UndoEntry>* undo_log, uint64_t& hash);
+        /**
+        * getStrikeAreaRadius: returns the strike area radius of the attacker, limited to a radius that covers the
+        * whole board, so the area can be walked without overflowing.
+        * @param attacker : the attacker.
+        * @return the radius.
+        */
+        template <class AttackerType>
+        int getStrikeAreaRadius(const AttackerType& attacker) const;
+        /**
+        * performAreaStrike: performs the strike of the attacker on every occupied cell of its strike area, other
+        * than the main target, in a range of rows.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param dst_coordinates : coordinates of the main target of the attack.
+        * @param attacker : the attacker.
+        * @param first_row : the first row of the range.
+        * @param last_row : the last row of the range.
+        * @param live_units : the live units counters to decrease when characters die.
+        * @param changes : the change log to record the modified cells in, in row-major order.
+        * @param undo_log : the undo entries to record the previous state of the modified cells in, or null if undo
+        * is disabled.
+        * @param hash : the position hash to xor the keys of the previous and new states of the cells into.
+        */
+        template <class AttackerType>
+        void performAreaStrike(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                               AttackerType& attacker, int first_row, int last_row,
+                               std::array<int, NUM_OF_TEAMS>& live_units, std::vector<CellChange>& changes,
+                               std::vector<UndoEntry>* undo_log, uint64_t& hash);
+        /**
+        * performParallelAreaStrike: performs the area strike of the attacker on bands of rows in parallel.
+        * every band covers whole rows of board tiles, so no tile, occupancy row or character is touched by two
+        * threads. every band counts its deaths and records its changes separately, and they are merged in the
+        * order of the bands, so the result is identical to the serial area strike.
+        * the strikes on cells other than the main target must not modify the attacker.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param dst_coordinates : coordinates of the main target of the attack.
+        * @param attacker : the attacker.
+        * @param first_row : the first row of the strike area.
+        * @param last_row : the last row of the strike area.
+        * @param num_of_threads : the maximal number of threads to use.
+        */
+        template <class AttackerType>
+        void performParallelAreaStrike(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                       AttackerType& attacker, int first_row, int last_row, int num_of_threads);
+        /**
+        * appendIfLegalTarget: adds the target coordinates to the list if the attacker can attack them.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param dst_coordinates : coordinates of the target, must be inside the board.
+        * @param attacker : the attacker.
+        * @param targets : the list to add the coordinates to.
+        */
+        template <class AttackerType>
+        void appendIfLegalTarget(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                 const AttackerType& attacker, std::vector<GridPoint>& targets) const;
+        /**
+        * collectLegalTargets: adds the legal targets of a Soldier - the cells in its row and column within its range.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param attacker : the attacker.
+        * @param targets : the list to add the targets to, in row-major order.
+        */
+        void collectLegalTargets(const GridPoint& src_coordinates, const Soldier& attacker,
+                                 std::vector<GridPoint>& targets) const;
+        /**
+        * collectLegalTargets: adds the legal targets of a Medic - the occupied cells within its range.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param attacker : the attacker.
+        * @param targets : the list to add the targets to, in row-major order.
+        */
+        void collectLegalTargets(const GridPoint& src_coordinates, const Medic& attacker,
+                                 std::vector<GridPoint>& targets) const;
+        /**
+        * collectLegalTargets: adds the legal targets of a Sniper - the occupied cells in the ring between its
+        * minimal strike range and its range.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param attacker : the attacker.
+        * @param targets : the list to add the targets to, in row-major order.
+        */
+        void collectLegalTargets(const GridPoint& src_coordinates, const Sniper& attacker,
+                                 std::vector<GridPoint>& targets) const;
+        /**
+        * collectLegalTargets: adds the legal targets of a character of any other class, by checking every cell
+        * of the board.
+        * @param src_coordinates : coordinates of the attacker.
+        * @param attacker : the attacker.
+        * @param targets : the list to add the targets to, in row-major order.
+        */
+        void collectLegalTargets(const GridPoint& src_coordinates, const Character& attacker,
+                                 std::vector<GridPoint>& targets) const;
+        /**
+        * throwIfFailed: throws the exception that matches a failed action status.
+        * @param status : the status of the action.
+        */
+        static void throwIfFailed(ActionStatus status);
+        /**
+        * areLiveUnitsCountersConsistent: compares the per team live units counters with a full scan of the board.
+        * used by debug builds to validate the counters.
+        * @return true if every counter equals the number of characters of its team on the board.
+        */
+        bool areLiveUnitsCountersConsistent() const;
+        /**
+        * checkLiveUnitsCounters: asserts that the live units counters are consistent after an action that changed
+        * them. the full scan runs once every (height x width / LIVE_UNITS_CHECK_CELLS_PER_ACTION) board versions,
+        * so debug builds scan a bounded number of cells per action on any board size - a counter that drifted
+        * stays wrong, so it is still caught by a later scan. does nothing when NDEBUG is defined.
+        */
+        void checkLiveUnitsCounters() const;
+        /**
+        * placeCharacter: puts a character in an empty cell of the board and counts it as a live unit of its team.
+        * @param coordinates : the coordinates of an empty cell inside the board.
+        * @param character : the character to place.
+        */
+        void placeCharacter(const GridPoint& coordinates, const std::shared_ptr<Character>& character);
+        /**
+        * takeBoard: replaces the board of the game with the board of another game, and leaves the other game with
+        * an empty board. the board version moves past the versions of both games and the change log and undo
+        * records are discarded, so no change or undo refers to the previous board. the journal of the game, if
+        * any, records the new board as a checkpoint.
+        * @param other : the game to take the board from.
+        */
+        void takeBoard(Game& other);
+        /**
+        * clearBoard: leaves the game with an empty board of no cells, no journal, no undo records and no known
+        * changes, as a game that was moved from.
+        */
+        void clearBoard();
+        /**
+        * startBoardVersion: advances the board version before a successful action modifies the board.
+        */
+        void startBoardVersion();
+        /**
+        * toggleCellHash: xors the key of the character at a cell into the position hash. called before and after
+        * the character is modified, or once when it is added or removed.
+        * @param coordinates : the coordinates of the cell. nothing is done if the cell is empty.
+        */
+        void toggleCellHash(const GridPoint& coordinates);
+        /**
+        * getUndoLog: returns the undo entries that the current action should be recorded in.
+        * @return the undo entries, or null if undo is disabled.
+        */
+        std::vector<UndoEntry>* getUndoLog();
+        /**
+        * beginUndoRecord: starts the undo record of an action, if undo is enabled.
+        */
+        void beginUndoRecord();
+        /**
+        * makeRestoreCellEntry: creates an undo entry that restores the current state of a character.
+        * @param coordinates : the coordinates of the character.
+        * @param character : the character.
+        * @return the entry.
+        */
+        static UndoEntry makeRestoreCellEntry(const GridPoint& coordinates, const Character& character);
+        /**
+        * revertUndoEntry: reverts a cell to the state that an undo entry recorded, and records the change.
+        * @param entry : the entry. a removed character is moved out of it.
+        */
+        void revertUndoEntry(UndoEntry& entry);
+        /**
+        * markCellChanged: records in the change log that the current board version modified a cell.
+        * @param coordinates : the coordinates of the modified cell.
+        */
+        void markCellChanged(const GridPoint& coordinates);
+        /**
+        * printRepeatedChar: writes a char to the stream a given number of times through the given buffer.
+        * @param os : the output stream to write to.
+        * @param buffer : a buffer of at least RENDER_CHUNK_CELLS chars.
+        * @param c : the char to write.
+        * @param count : the number of times to write the char.
+        */
+        static void printRepeatedChar(std::ostream& os, char* buffer, char c, int count);
         /**
         * isOverReturnResult: checks if the game is over.
         * @param winningTeam : ptr to the field of the winning team which should be edited if there is a winner and
@@ -81,13 +427,37 @@ namespace mtm
         */
         Game(const Game& other);
         /**
-        * operator=: copies all of the fields of one game to the fields of the current game instance.
-        * after the copy the two games are independent.
-        * @param other : the game instance to copy his fields.
+        * operator=: replaces the board of the game with a copy of the board of another game.
+        * after the copy the two games are independent. the game keeps its own journal, strike threads and undo
+        * setting - the board is recorded in the journal as a checkpoint, and the undo records are discarded.
+        * @param other : the game instance to copy his board.
         * @return reference to the game instance which his class were updated.
         */
         Game& operator=(const Game& other);
         /**
+        * Move Constructor - initializes game instance with the board, history and settings of another game,
+        * including its journal. the other game is left with an empty board of no cells, no journal and no undo
+        * records.
+        * @param other : the game to take the board from.
+        */
+        Game(Game&& other) noexcept;
+        /**
+        * operator=: replaces the board of the game with the board of another game, like the copy assignment, and
+        * leaves the other game like the move constructor does.
+        * @param other : the game to take the board from.
+        * @return reference to the game instance.
+        */
+        Game& operator=(Game&& other);
+        /**
+        * fork: creates a snapshot of the game that shares the board with it.
+        * the snapshot and the game are independent like after a copy, but the board tiles and the characters in them
+        * are only copied when one of the games modifies them, so forking costs a copy of the tile pointers and the
+        * occupancy bits instead of a clone of every character.
+        * after a fork, characters that were given to addCharacter may be replaced by clones in both games.
+        * @return the snapshot of the game.
+        */
+        Game fork() const;
+        /**
         * addCharacter: adds character to the game board in a chosen coordinates.
         * @param coordinates: the coordinates to add the character to.
         * @param character : shared pointer to the character we want to add to the game.
@@ -128,6 +498,8 @@ namespace mtm
         * the character at the dst coordinates (if there is one) will be affected by the attack according to the type
         * of the attacking character.
         * if as a result of the attack one of the characters on the board die, we will remove it from the board.
+        * only the main target and the occupied cells inside the attacker's strike area are visited, so the cost of
+        * the attack depends on the strike area and not on the size of the board.
         * @param src_coordinates : the coordinates of the attacker.
         * @param dst_coordinates : the coordinates of the target.
         * possible errors:
@@ -148,6 +520,114 @@ namespace mtm
         */
         void reload(const GridPoint & coordinates);
         /**
+        * tryMove: moves the character from src coordinates to dst coordinates like move, but reports a failure
+        * as a status instead of throwing an exception. a failed move does not change the game.
+        * @param src_coordinates : the coordinates to move the character from.
+        * @param dst_coordinates : the coordinates to move the character to.
+        * @return ACTION_SUCCESS if the character was moved, otherwise the status that matches the exception move
+        * throws - ACTION_ILLEGAL_CELL, ACTION_CELL_EMPTY, ACTION_MOVE_TOO_FAR or ACTION_CELL_OCCUPIED.
+        */
+        ActionStatus tryMove(const GridPoint& src_coordinates, const GridPoint& dst_coordinates);
+        /**
+        * tryAttack: performs the attack of the character at the src coordinates like attack, but reports a failure
+        * as a status instead of throwing an exception. a failed attack does not change the game.
+        * @param src_coordinates : the coordinates of the attacker.
+        * @param dst_coordinates : the coordinates of the target.
+        * @return ACTION_SUCCESS if the attack was performed, otherwise the status that matches the exception attack
+        * throws - ACTION_ILLEGAL_CELL, ACTION_CELL_EMPTY, ACTION_OUT_OF_RANGE, ACTION_OUT_OF_AMMO or
+        * ACTION_ILLEGAL_TARGET.
+        */
+        ActionStatus tryAttack(const GridPoint& src_coordinates, const GridPoint& dst_coordinates);
+        /**
+        * tryReload: reloads the ammo of the character at the given coordinates like reload, but reports a failure
+        * as a status instead of throwing an exception.
+        * @param coordinates : the coordinates of the character to reload.
+        * @return ACTION_SUCCESS if the character was reloaded, otherwise ACTION_ILLEGAL_CELL or ACTION_CELL_EMPTY.
+        */
+        ActionStatus tryReload(const GridPoint& coordinates);
+        /**
+        * legalMoves: lists every cell the character at the given coordinates can move to - the empty cells within
+        * its movement range. the cells are found by scanning the rows of the movement range over the bitboard of
+        * occupied cells, without trying the moves.
+        * @param coordinates : the coordinates of the character.
+        * @param destinations : cleared and filled with the legal destinations, in row-major order.
+        * @return ACTION_SUCCESS, or ACTION_ILLEGAL_CELL if the coordinates are out of the board, or
+        * ACTION_CELL_EMPTY if there is no character at the coordinates.
+        */
+        ActionStatus legalMoves(const GridPoint& coordinates, std::vector<GridPoint>& destinations) const;
+        /**
+        * legalTargets: lists every cell the character at the given coordinates can attack, by the rules of its type.
+        * only the cells its type can reach are walked - the row and column of a Soldier, the occupied cells in
+        * range of a Medic and the occupied cells in the ring of a Sniper - and every candidate is checked with the
+        * same checks as attack, so the list holds exactly the cells attack would accept. the game is not modified.
+        * @param coordinates : the coordinates of the character.
+        * @param targets : cleared and filled with the legal targets, in row-major order.
+        * @return ACTION_SUCCESS, or ACTION_ILLEGAL_CELL if the coordinates are out of the board, or
+        * ACTION_CELL_EMPTY if there is no character at the coordinates.
+        */
+        ActionStatus legalTargets(const GridPoint& coordinates, std::vector<GridPoint>& targets) const;
+        /**
+        * setJournal: sets the journal that every successful addCharacter, move, attack and reload of the game is
+        * appended to. the journal is not owned by the game and must stay alive while it is set.
+        * copies and forks of the game do not write to the journal.
+        * @param journal : the journal to append to, or null to stop journaling.
+        */
+        void setJournal(ActionJournal* journal);
+        /**
+        * getPositionHash: returns the zobrist hash of the characters on the board and their cells.
+        * the hash is updated by every action in the time of the cells it modifies, and equal positions have equal
+        * hashes, so it can key caches of search results such as TranspositionTable.
+        * @return the position hash.
+        */
+        uint64_t getPositionHash() const;
+        /**
+        * setUndoEnabled: starts or stops recording undo records of the actions of the game.
+        * while undo is enabled, every successful addCharacter, move, attack and reload records the previous state
+        * of the cells it modified, so it can be reverted by undo. the records reuse their memory, so a depth-first
+        * search that performs and undoes actions does not allocate once the records have grown to its depth.
+        * copies and forks of the game start with no records.
+        * @param is_enabled : true to record undo records. false also discards the existing records.
+        */
+        void setUndoEnabled(bool is_enabled);
+        /**
+        * undo: reverts the last recorded action that was not reverted yet - the health, ammo and strikes counters
+        * of the characters it modified, the characters it killed, and the live units counters.
+        * the revert is a new version of the board. if the game has a journal, the game after the revert is appended
+        * to it as a checkpoint, so replaying the journal continues from the reverted game. a checkpoint is a
+        * snapshot of the whole board, so a search that undoes many actions should not keep a journal set.
+        * @return true if an action was reverted, false if there is no recorded action.
+        */
+        bool undo();
+        /**
+        * setStrikeThreads: sets the number of threads that resolve the strike area of an attack.
+        * attacks whose strike area is large enough are split into bands of rows that are resolved in parallel.
+        * the result is identical to resolving the attack with a single thread. the default is 1.
+        * @param num_of_threads : the maximal number of threads, or 0 for one thread for every hardware thread.
+        * possible errors:
+        *      - IllegalArgument : if the number of threads is negative.
+        */
+        void setStrikeThreads(int num_of_threads);
+        /**
+        * tryAction: performs a single action like the matching tryMove, tryAttack or tryReload.
+        * @param action : the action to perform.
+        * @return ACTION_SUCCESS if the action was performed, otherwise the reason it could not be performed.
+        */
+        ActionStatus tryAction(const Action& action);
+        /**
+        * applyBatch: performs a list of actions in order, as a single change of the game. every action is checked
+        * against the game as the previous actions of the batch left it, and an action that fails does not change
+        * the game and does not stop the batch.
+        * the successful actions of the batch share a single board version, so getBoardChanges reports them as one
+        * change, and a single undo record, so undo reverts the whole batch. the batch is timed as a single
+        * BATCH_OPERATION instead of an operation for every action. every successful action is still appended to
+        * the journal on its own, since the journal replays actions one at a time. a batch with no successful
+        * action does not change the board version and adds no undo record.
+        * @param actions : the actions to perform.
+        * @param results : resized to the number of actions and filled with the status of every action -
+        * ACTION_SUCCESS, or the failure that matches the exception the single action would have thrown.
+        */
+        void applyBatch(const std::vector<Action>& actions, std::vector<ActionStatus>& results);
+        /**
         * operator<< : prints the board of the game in a specific format.
         * the game board will be in the following format:
         *      - empty cell in the board - ' '.
@@ -157,9 +637,23 @@ namespace mtm
         * @param os : the output stream to print the data to.
         * @param game : the game to print his board.
         * @return  the output stream that we receive in order to able concatenation.
-        *
+        * the board is streamed row by row like printBoardRegion, so printing uses bounded memory.
         */
         friend std::ostream& operator<<(std::ostream& os, const Game& game);
+        /**
+        * printBoardRegion: prints a rectangle of the board in the format of operator<< (the format of
+        * printGameBoard), as if the rectangle was a board of its own.
+        * the rows are written straight to the stream through a fixed size buffer, so the memory used does not
+        * depend on the size of the board or of the rectangle.
+        * @param os : the output stream to print the rectangle to.
+        * @param top_left : the coordinates of the top left cell of the rectangle.
+        * @param num_of_rows : the number of rows in the rectangle.
+        * @param num_of_cols : the number of columns in the rectangle.
+        * possible errors:
+        *      - IllegalArgument : if num_of_rows or num_of_cols is not positive.
+        *      - IllegalCell : if the rectangle is not fully inside the game's board.
+        */
+        void printBoardRegion(std::ostream& os, const GridPoint& top_left, int num_of_rows, int num_of_cols) const;
 
         /**
          * isOver : checks if in the current game state there is a winner.
@@ -169,8 +663,40 @@ namespace mtm
          * if winning team is different than NULL the function update the winning team value with the winning team
          * identity.
          * if there is characters from both teams on the boards or from none of the teams the function returns false.
+         * runs in constant time using the live units counters of the teams.
          */
         bool isOver(Team* winningTeam=NULL) const;
+        /**
+        * getBoardVersion: returns the version of the board. the version starts at 0 and grows by one with every
+        * successful addCharacter, move, attack and reload.
+        * @return the current version of the board.
+        */
+        unsigned long long getBoardVersion() const;
+        /**
+        * getBoardChanges: lists the cells that were modified after a given version of the board, with their current
+        * content, so a spectator that printed the board at that version can catch up without printing it again.
+        * only the most recent changes are kept, and a copied or forked game keeps no changes from before the copy.
+        * @param since_version : the version of the board the caller already has.
+        * @param updates : cleared and filled with the modified cells, in row-major order, each cell once.
+        * @return true if the changes since the given version are known. false if the version is too old or newer
+        * than the board, in which case the whole board should be printed again.
+        */
+        bool getBoardChanges(unsigned long long since_version, std::vector<CellUpdate>& updates) const;
+        /**
+        * exportUnits: appends the state of every character on the board to a compact unit store, in row-major
+        * order of their coordinates.
+        * @param store : the store to add the characters to.
+        */
+        void exportUnits(UnitStore& store) const;
+        /**
+        * getCharacter: borrows the character at the given coordinates, for reading. the pointer is valid until the
+        * cell is next modified.
+        * @param coordinates : the coordinates of the cell.
+        * @return the character at the cell, or null if the cell is empty.
+        * possible errors:
+        *      - IllegalCell : if the coordinates are out of the board.
+        */
+        const Character* getCharacter(const GridPoint& coordinates) const;
     };
     std::ostream& operator<<(std::ostream& os, const Game& game);
 }
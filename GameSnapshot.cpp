@@ -0,0 +1,151 @@
+#include "GameSnapshot.h"
+#include "LittleEndian.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GAME_SNAPSHOT_USE_MMAP
+#endif
+
+namespace mtm
+{
+    using std::vector;
+    using std::shared_ptr;
+
+    const char GameSnapshot::MAGIC[4] = {'R', 'P', 'G', 'S'};
+    const uint32_t GameSnapshot::FORMAT_VERSION = 1;
+    const size_t GameSnapshot::HEADER_SIZE = 24;
+    const size_t GameSnapshot::RECORD_SIZE = 30;
+    const int GameSnapshot::MAX_BOARD_SIDE = 1 << 16;
+    const uint64_t GameSnapshot::MAX_NUM_OF_CELLS = uint64_t(1) << 30;
+
+    void GameSnapshot::serialize(const Game& game, vector<char>& data) {
+        uint64_t num_of_characters = game.live_units_per_team[POWERLIFTERS] + game.live_units_per_team[CROSSFITTERS];
+        data.reserve(data.size() + HEADER_SIZE + num_of_characters * RECORD_SIZE);
+        data.insert(data.end(), MAGIC, MAGIC + sizeof(MAGIC));
+        LittleEndian::writeUint32(data, FORMAT_VERSION);
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(game.height));
+        LittleEndian::writeUint32(data, static_cast<uint32_t>(game.width));
+        LittleEndian::writeUint64(data, num_of_characters);
+        for (int r = 0; r < game.height; r++)
+        {
+            game.occupancy.forEachOccupiedInRow(r, 0, game.width - 1, [&](int c) {
+                const Character& character = *game.board.getCell(GridPoint(r, c));
+                LittleEndian::writeUint32(data, static_cast<uint32_t>(r));
+                LittleEndian::writeUint32(data, static_cast<uint32_t>(c));
+                data.push_back(static_cast<char>(character.getCharacterType()));
+                data.push_back(static_cast<char>(character.getCharacterTeam()));
+                LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterHealthPoints()));
+                LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterAmmo()));
+                LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterRange()));
+                LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getCharacterPower()));
+                LittleEndian::writeUint32(data, static_cast<uint32_t>(character.getSuccessfulStrikesCounter()));
+            });
+        }
+    }
+
+    Game GameSnapshot::deserialize(const char* data, size_t size) {
+        if (size < HEADER_SIZE || memcmp(data, MAGIC, sizeof(MAGIC)) != 0 ||
+            LittleEndian::readUint32(data + 4) != FORMAT_VERSION)
+        {
+            throw InvalidSnapshot();
+        }
+        int height = static_cast<int>(LittleEndian::readUint32(data + 8));
+        int width = static_cast<int>(LittleEndian::readUint32(data + 12));
+        uint64_t num_of_characters = LittleEndian::readUint64(data + 16);
+        if (height <= 0 || width <= 0 || num_of_characters != (size - HEADER_SIZE) / RECORD_SIZE ||
+            (size - HEADER_SIZE) % RECORD_SIZE != 0)
+        {
+            throw InvalidSnapshot();
+        }
+        uint64_t num_of_cells = static_cast<uint64_t>(height) * static_cast<uint64_t>(width);
+        if (height > MAX_BOARD_SIDE || width > MAX_BOARD_SIDE || num_of_cells > MAX_NUM_OF_CELLS ||
+            num_of_characters > num_of_cells)
+        {
+            throw InvalidSnapshot();
+        }
+        Game game(height, width);
+        for (const char* record = data + HEADER_SIZE; record != data + size; record += RECORD_SIZE)
+        {
+            GridPoint coordinates(static_cast<int>(LittleEndian::readUint32(record)),
+                                  static_cast<int>(LittleEndian::readUint32(record + 4)));
+            unsigned char type = static_cast<unsigned char>(record[8]);
+            unsigned char team = static_cast<unsigned char>(record[9]);
+            units_t health = static_cast<units_t>(LittleEndian::readUint32(record + 10));
+            units_t ammo = static_cast<units_t>(LittleEndian::readUint32(record + 14));
+            units_t range = static_cast<units_t>(LittleEndian::readUint32(record + 18));
+            units_t power = static_cast<units_t>(LittleEndian::readUint32(record + 22));
+            int successful_strikes_counter = static_cast<int>(LittleEndian::readUint32(record + 26));
+            if (game.areCoordinatesIllegal(coordinates) || !game.isCellEmpty(coordinates) || type > SNIPER ||
+                team > CROSSFITTERS || health <= 0 || ammo < 0 || range < 0 || power < 0 ||
+                successful_strikes_counter < 0)
+            {
+                throw InvalidSnapshot();
+            }
+            shared_ptr<Character> character = Game::makeCharacter(static_cast<CharacterType>(type),
+                                                                  static_cast<Team>(team), health, ammo, range, power);
+            character->setSuccessfulStrikesCounter(successful_strikes_counter);
+            game.placeCharacter(coordinates, character);
+        }
+        return game;
+    }
+
+    void GameSnapshot::saveToFile(const Game& game, const std::string& path) {
+        vector<char> data;
+        serialize(game, data);
+        std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+        file.write(data.data(), data.size());
+        file.close();
+        if (!file)
+        {
+            throw InvalidSnapshot();
+        }
+    }
+
+    Game GameSnapshot::loadFromFile(const std::string& path) {
+#ifdef GAME_SNAPSHOT_USE_MMAP
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw InvalidSnapshot();
+        }
+        struct stat file_status;
+        if (fstat(fd, &file_status) != 0 || file_status.st_size <= 0)
+        {
+            close(fd);
+            throw InvalidSnapshot();
+        }
+        size_t size = static_cast<size_t>(file_status.st_size);
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED)
+        {
+            throw InvalidSnapshot();
+        }
+        madvise(mapped, size, MADV_SEQUENTIAL);
+        try
+        {
+            Game game = deserialize(static_cast<const char*>(mapped), size);
+            munmap(mapped, size);
+            return game;
+        }
+        catch (...)
+        {
+            munmap(mapped, size);
+            throw;
+        }
+#else
+        std::ifstream file(path.c_str(), std::ios::binary);
+        if (!file)
+        {
+            throw InvalidSnapshot();
+        }
+        vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return deserialize(data.data(), data.size());
+#endif
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef GAME_PROJECT_GAMESNAPSHOT_H
+#define GAME_PROJECT_GAMESNAPSHOT_H
+#include "Game.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace mtm
+{
+    /**
+    * class GameSnapshot:
+    *      saves and restores the state of a game in a compact, versioned binary format.
+    *      the format is a header followed by one fixed size record for every character on the board:
+    *          header - "RPGS", format version (u32), height (i32), width (i32), number of characters (u64).
+    *          record - row (i32), col (i32), type (u8), team (u8), health (i32), ammo (i32), range (i32),
+    *                   power (i32), successful strikes counter of a sniper (i32).
+    *      all the numbers are little endian, and the records are sorted by their coordinates in row-major order.
+    *      empty cells take no space, and a snapshot is restored in a single pass over its records.
+    *      a snapshot of a board with a side longer than MAX_BOARD_SIDE or with more than MAX_NUM_OF_CELLS cells is
+    *      not restored, so a corrupted header cannot make the restore allocate an arbitrarily large board.
+    */
+    class GameSnapshot {
+    private:
+        static const char MAGIC[4];
+        static const uint32_t FORMAT_VERSION;
+        static const size_t HEADER_SIZE;
+        static const size_t RECORD_SIZE;
+        static const int MAX_BOARD_SIDE;
+        static const uint64_t MAX_NUM_OF_CELLS;
+
+
+    public:
+        /**
+        * serialize: appends the snapshot of a game to the given data.
+        * @param game : the game to save.
+        * @param data : the data to append the snapshot to.
+        */
+        static void serialize(const Game& game, std::vector<char>& data);
+        /**
+        * deserialize: creates a game from a snapshot.
+        * @param data : pointer to the first byte of the snapshot.
+        * @param size : the size of the snapshot in bytes.
+        * @return the game that was saved in the snapshot.
+        * possible errors:
+        *      - InvalidSnapshot : if the data is not a valid snapshot of the supported format version, its board is
+        *        larger than MAX_BOARD_SIDE or MAX_NUM_OF_CELLS allow, or it has more records than cells.
+        */
+        static Game deserialize(const char* data, size_t size);
+        /**
+        * saveToFile: writes the snapshot of a game to a file, replacing its content.
+        * @param game : the game to save.
+        * @param path : the path of the file.
+        * possible errors:
+        *      - InvalidSnapshot : if the file cannot be written.
+        */
+        static void saveToFile(const Game& game, const std::string& path);
+        /**
+        * loadFromFile: creates a game from a snapshot file. where it is supported the file is memory mapped, so the
+        * records are read straight from the page cache without copying the file first.
+        * @param path : the path of the file.
+        * @return the game that was saved in the file.
+        * possible errors:
+        *      - InvalidSnapshot : if the file cannot be read or is not a valid snapshot.
+        */
+        static Game loadFromFile(const std::string& path);
+    };
+}
+
+#endif //GAME_PROJECT_GAMESNAPSHOT_H
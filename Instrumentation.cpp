@@ -0,0 +1,246 @@
+#include "Instrumentation.h"
+#include "Exceptions.h"
+#include <fstream>
+
+namespace mtm
+{
+    using std::vector;
+
+    const int InstrumentationSnapshot::NUM_OF_OPERATIONS;
+    const int InstrumentationSnapshot::NUM_OF_COUNTERS;
+    const int InstrumentationSnapshot::NUM_OF_STATUSES;
+    const int InstrumentationSnapshot::NUM_OF_LATENCY_BUCKETS;
+
+    const int Instrumentation::CALLS_OFFSET = 0;
+    const int Instrumentation::NANOSECONDS_OFFSET = CALLS_OFFSET + InstrumentationSnapshot::NUM_OF_OPERATIONS;
+    const int Instrumentation::HISTOGRAMS_OFFSET = NANOSECONDS_OFFSET + InstrumentationSnapshot::NUM_OF_OPERATIONS;
+    const int Instrumentation::COUNTERS_OFFSET = HISTOGRAMS_OFFSET + InstrumentationSnapshot::NUM_OF_OPERATIONS *
+                                                                     InstrumentationSnapshot::NUM_OF_LATENCY_BUCKETS;
+    const int Instrumentation::EXCEPTIONS_OFFSET = COUNTERS_OFFSET + InstrumentationSnapshot::NUM_OF_COUNTERS;
+    const int Instrumentation::NUM_OF_VALUES = EXCEPTIONS_OFFSET + InstrumentationSnapshot::NUM_OF_STATUSES;
+    const size_t Instrumentation::MAX_TRACE_EVENTS_PER_THREAD = 1 << 20;
+    const char* const Instrumentation::OPERATION_NAMES[InstrumentationSnapshot::NUM_OF_OPERATIONS] = {
+            "attack", "move", "reload", "copy", "print", "batch"
+    };
+    std::mutex Instrumentation::registry_lock;
+    vector<Instrumentation::ThreadBlock*> Instrumentation::thread_blocks;
+    vector<uint64_t> Instrumentation::retired_values(Instrumentation::NUM_OF_VALUES, 0);
+    vector<Instrumentation::RetiredTraceEvent> Instrumentation::retired_trace_events;
+    int Instrumentation::next_thread_id = 1;
+    std::atomic<bool> Instrumentation::is_tracing(false);
+    std::atomic<std::chrono::steady_clock::rep> Instrumentation::trace_start_ticks(0);
+
+    Instrumentation::ThreadBlock::ThreadBlock() : thread_id(0), values(NUM_OF_VALUES), trace_lock(), trace_events()
+    {
+        for (std::atomic<uint64_t>& value : values)
+        {
+            value.store(0, std::memory_order_relaxed);
+        }
+        std::lock_guard<std::mutex> guard(registry_lock);
+        thread_id = next_thread_id++;
+        thread_blocks.push_back(this);
+    }
+
+    Instrumentation::ThreadBlock::~ThreadBlock() {
+        std::lock_guard<std::mutex> guard(registry_lock);
+        for (int i = 0; i < NUM_OF_VALUES; i++)
+        {
+            retired_values[i] += values[i].load(std::memory_order_relaxed);
+        }
+        {
+            std::lock_guard<std::mutex> trace_guard(trace_lock);
+            for (const TraceEvent& event : trace_events)
+            {
+                RetiredTraceEvent retired_event = {thread_id, event};
+                retired_trace_events.push_back(retired_event);
+            }
+        }
+        for (size_t i = 0; i < thread_blocks.size(); i++)
+        {
+            if (thread_blocks[i] == this)
+            {
+                thread_blocks[i] = thread_blocks.back();
+                thread_blocks.pop_back();
+                break;
+            }
+        }
+    }
+
+    Instrumentation::ThreadBlock& Instrumentation::getThreadBlock() {
+        static thread_local ThreadBlock block;
+        return block;
+    }
+
+    void Instrumentation::increment(int index, uint64_t amount) {
+        std::atomic<uint64_t>& value = getThreadBlock().values[index];
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    int Instrumentation::getLatencyBucket(uint64_t nanoseconds) {
+        int bucket = 0;
+        while (nanoseconds > 1 && bucket < InstrumentationSnapshot::NUM_OF_LATENCY_BUCKETS - 1)
+        {
+            nanoseconds >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    void Instrumentation::recordOperation(InstrumentedOperation operation, std::chrono::steady_clock::time_point start,
+                                          std::chrono::steady_clock::time_point end) {
+        uint64_t nanoseconds = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        increment(CALLS_OFFSET + operation, 1);
+        increment(NANOSECONDS_OFFSET + operation, nanoseconds);
+        increment(HISTOGRAMS_OFFSET + operation * InstrumentationSnapshot::NUM_OF_LATENCY_BUCKETS +
+                  getLatencyBucket(nanoseconds), 1);
+        if (!is_tracing.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        std::chrono::steady_clock::time_point trace_start(std::chrono::steady_clock::duration(
+                trace_start_ticks.load(std::memory_order_relaxed)));
+        ThreadBlock& block = getThreadBlock();
+        std::lock_guard<std::mutex> guard(block.trace_lock);
+        if (block.trace_events.size() < MAX_TRACE_EVENTS_PER_THREAD)
+        {
+            TraceEvent event = {operation, std::chrono::duration<double, std::micro>(start - trace_start).count(),
+                                std::chrono::duration<double, std::micro>(end - start).count()};
+            block.trace_events.push_back(event);
+        }
+    }
+
+    Instrumentation::ScopedOperation::ScopedOperation(InstrumentedOperation operation) :
+            operation(operation), start(std::chrono::steady_clock::now())
+    {}
+
+    Instrumentation::ScopedOperation::~ScopedOperation() {
+        recordOperation(operation, start, std::chrono::steady_clock::now());
+    }
+
+    bool Instrumentation::isCompiledIn() {
+#ifdef GAME_ENABLE_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void Instrumentation::addToCounter(InstrumentedCounter counter, uint64_t amount) {
+        increment(COUNTERS_OFFSET + counter, amount);
+    }
+
+    void Instrumentation::recordException(ActionStatus status) {
+        increment(EXCEPTIONS_OFFSET + status, 1);
+    }
+
+    void Instrumentation::getSnapshot(InstrumentationSnapshot& snapshot) {
+        vector<uint64_t> totals;
+        {
+            std::lock_guard<std::mutex> guard(registry_lock);
+            totals = retired_values;
+            for (const ThreadBlock* block : thread_blocks)
+            {
+                for (int i = 0; i < NUM_OF_VALUES; i++)
+                {
+                    totals[i] += block->values[i].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        for (int operation = 0; operation < InstrumentationSnapshot::NUM_OF_OPERATIONS; operation++)
+        {
+            snapshot.calls[operation] = totals[CALLS_OFFSET + operation];
+            snapshot.total_nanoseconds[operation] = totals[NANOSECONDS_OFFSET + operation];
+            int histogram_offset = HISTOGRAMS_OFFSET + operation * InstrumentationSnapshot::NUM_OF_LATENCY_BUCKETS;
+            for (int bucket = 0; bucket < InstrumentationSnapshot::NUM_OF_LATENCY_BUCKETS; bucket++)
+            {
+                snapshot.latency_histograms[operation][bucket] = totals[histogram_offset + bucket];
+            }
+        }
+        for (int counter = 0; counter < InstrumentationSnapshot::NUM_OF_COUNTERS; counter++)
+        {
+            snapshot.counters[counter] = totals[COUNTERS_OFFSET + counter];
+        }
+        for (int status = 0; status < InstrumentationSnapshot::NUM_OF_STATUSES; status++)
+        {
+            snapshot.exceptions[status] = totals[EXCEPTIONS_OFFSET + status];
+        }
+    }
+
+    void Instrumentation::reset() {
+        std::lock_guard<std::mutex> guard(registry_lock);
+        retired_values.assign(NUM_OF_VALUES, 0);
+        for (ThreadBlock* block : thread_blocks)
+        {
+            for (std::atomic<uint64_t>& value : block->values)
+            {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Instrumentation::startTrace() {
+        std::lock_guard<std::mutex> guard(registry_lock);
+        is_tracing.store(false, std::memory_order_release);
+        retired_trace_events.clear();
+        for (ThreadBlock* block : thread_blocks)
+        {
+            std::lock_guard<std::mutex> trace_guard(block->trace_lock);
+            block->trace_events.clear();
+        }
+        trace_start_ticks.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                                std::memory_order_relaxed);
+        is_tracing.store(true, std::memory_order_release);
+    }
+
+    void Instrumentation::stopTrace() {
+        is_tracing.store(false, std::memory_order_release);
+    }
+
+    void Instrumentation::writeTraceEvent(std::ostream& os, int thread_id, const TraceEvent& event, bool is_first) {
+        if (!is_first)
+        {
+            os << ",\n";
+        }
+        os << "{\"name\":\"" << OPERATION_NAMES[event.operation] << "\",\"cat\":\"game\",\"ph\":\"X\",\"ts\":"
+           << event.start_microseconds << ",\"dur\":" << event.duration_microseconds << ",\"pid\":1,\"tid\":"
+           << thread_id << "}";
+    }
+
+    void Instrumentation::writeChromeTrace(std::ostream& os) {
+        std::lock_guard<std::mutex> guard(registry_lock);
+        std::ios_base::fmtflags flags = os.flags();
+        os.setf(std::ios_base::fixed, std::ios_base::floatfield);
+        os << "{\"traceEvents\":[\n";
+        bool is_first = true;
+        for (const RetiredTraceEvent& retired_event : retired_trace_events)
+        {
+            writeTraceEvent(os, retired_event.thread_id, retired_event.event, is_first);
+            is_first = false;
+        }
+        for (ThreadBlock* block : thread_blocks)
+        {
+            std::lock_guard<std::mutex> trace_guard(block->trace_lock);
+            for (const TraceEvent& event : block->trace_events)
+            {
+                writeTraceEvent(os, block->thread_id, event, is_first);
+                is_first = false;
+            }
+        }
+        os << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+        os.flags(flags);
+    }
+
+    void Instrumentation::saveChromeTrace(const std::string& path) {
+        std::ofstream file(path.c_str(), std::ios::out | std::ios::trunc);
+        if (!file)
+        {
+            throw IllegalArgument();
+        }
+        writeChromeTrace(file);
+        if (!file)
+        {
+            throw IllegalArgument();
+        }
+    }
+}
@@ -0,0 +1,263 @@
+#ifndef GAME_PROJECT_INSTRUMENTATION_H
+#define GAME_PROJECT_INSTRUMENTATION_H
+#include "Action.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+/**
+* the instrumentation hooks of the game. they are compiled in only when GAME_ENABLE_INSTRUMENTATION is defined, and
+* expand to nothing otherwise, so a build without it pays nothing for them.
+* GAME_INSTRUMENT_OPERATION times the rest of its scope. GAME_INSTRUMENT_EXPRESSION times the full expression that it
+* is part of - in a mem-initializer, that includes the constructor the initializer calls.
+*/
+#ifdef GAME_ENABLE_INSTRUMENTATION
+#define GAME_INSTRUMENT_OPERATION(operation) \
+        mtm::Instrumentation::ScopedOperation instrumented_operation_scope(mtm::operation)
+#define GAME_INSTRUMENT_EXPRESSION(operation, expression) \
+        (mtm::Instrumentation::ScopedOperation(mtm::operation), (expression))
+#define GAME_INSTRUMENT_COUNT(counter, amount) mtm::Instrumentation::addToCounter(mtm::counter, amount)
+#define GAME_INSTRUMENT_EXCEPTION(status) mtm::Instrumentation::recordException(status)
+#else
+#define GAME_INSTRUMENT_OPERATION(operation) ((void)0)
+#define GAME_INSTRUMENT_EXPRESSION(operation, expression) (expression)
+#define GAME_INSTRUMENT_COUNT(counter, amount) ((void)0)
+#define GAME_INSTRUMENT_EXCEPTION(status) ((void)0)
+#endif
+
+namespace mtm
+{
+    /**
+    * enum InstrumentedOperation:
+    *      the operations of the game that are counted and timed.
+    *      COPY_OPERATION is a copy of a game by the copy constructor or the copy assignment, from the copy of the
+    *      first member to the clone of the last character. forks share the tiles instead of copying them, and are
+    *      not counted.
+    *      BATCH_OPERATION is a call of Game::applyBatch. the actions of the batch are not counted as move, attack
+    *      or reload operations.
+    */
+    enum InstrumentedOperation {
+        ATTACK_OPERATION,
+        MOVE_OPERATION,
+        RELOAD_OPERATION,
+        COPY_OPERATION,
+        PRINT_OPERATION,
+        BATCH_OPERATION
+    };
+
+    /**
+    * enum InstrumentedCounter:
+    *      the events inside the operations of the game that are counted.
+    */
+    enum InstrumentedCounter {
+        PERFORMED_ATTACKS_COUNTER,
+        CELLS_VISITED_COUNTER,
+        VIRTUAL_STRIKE_CALLS_COUNTER,
+        UNITS_KILLED_COUNTER
+    };
+
+    /**
+    * struct InstrumentationSnapshot:
+    *      the totals of the instrumentation counters of all the threads.
+    *      bucket b of a latency histogram counts the operations that took [2^b, 2^(b+1)) nanoseconds, bucket 0 also
+    *      counts operations that took less than a nanosecond, and the last bucket also counts longer operations.
+    *      the exceptions are counted by the status that matches their type, e.g. exceptions[ACTION_OUT_OF_AMMO]
+    *      counts the OutOfAmmo exceptions.
+    */
+    struct InstrumentationSnapshot {
+        static const int NUM_OF_OPERATIONS = BATCH_OPERATION + 1;
+        static const int NUM_OF_COUNTERS = UNITS_KILLED_COUNTER + 1;
+        static const int NUM_OF_STATUSES = ACTION_ILLEGAL_TARGET + 1;
+        static const int NUM_OF_LATENCY_BUCKETS = 40;
+
+        unsigned long long calls[NUM_OF_OPERATIONS];
+        unsigned long long total_nanoseconds[NUM_OF_OPERATIONS];
+        unsigned long long latency_histograms[NUM_OF_OPERATIONS][NUM_OF_LATENCY_BUCKETS];
+        unsigned long long counters[NUM_OF_COUNTERS];
+        unsigned long long exceptions[NUM_OF_STATUSES];
+    };
+
+    /**
+    * class Instrumentation:
+    *      counters and trace events of the hot paths of the game, for finding where the time goes.
+    *      every thread counts into its own block of counters, so counting never contends between threads. the
+    *      blocks are single-writer atomics that are read without stopping their threads, and the counts of exited
+    *      threads are kept in a retired block.
+    *      while a trace is recorded, every timed operation also adds a complete event to the trace buffer of its
+    *      thread, which can be written as a Chrome trace (chrome://tracing or Perfetto) JSON file.
+    *      the game calls the instrumentation through the GAME_INSTRUMENT macros, which are empty unless the game
+    *      is compiled with GAME_ENABLE_INSTRUMENTATION. the snapshot and trace methods can always be called, and
+    *      report nothing when the hooks are compiled out.
+    */
+    class Instrumentation {
+    private:
+        static const int CALLS_OFFSET;
+        static const int NANOSECONDS_OFFSET;
+        static const int HISTOGRAMS_OFFSET;
+        static const int COUNTERS_OFFSET;
+        static const int EXCEPTIONS_OFFSET;
+        static const int NUM_OF_VALUES;
+        static const size_t MAX_TRACE_EVENTS_PER_THREAD;
+        static const char* const OPERATION_NAMES[InstrumentationSnapshot::NUM_OF_OPERATIONS];
+
+        /**
+        * struct TraceEvent:
+        *      a timed operation of a thread, relative to the start of the trace.
+        */
+        struct TraceEvent {
+            InstrumentedOperation operation;
+            double start_microseconds;
+            double duration_microseconds;
+        };
+
+        /**
+        * class ThreadBlock:
+        *      the counters and trace buffer of a thread. registers itself when the thread first counts, and moves its
+        *      counts and events to the retired ones when the thread exits. the values are laid out as the calls, the
+        *      total nanoseconds and the latency histograms of the operations, then the counters and the exceptions,
+        *      starting at the matching offsets.
+        */
+        class ThreadBlock {
+        public:
+            int thread_id;
+            std::vector<std::atomic<uint64_t>> values;
+            std::mutex trace_lock;
+            std::vector<TraceEvent> trace_events;
+
+            ThreadBlock();
+            ThreadBlock(const ThreadBlock& other) = delete;
+            ThreadBlock& operator=(const ThreadBlock& other) = delete;
+            ~ThreadBlock();
+        };
+
+        /**
+        * struct RetiredTraceEvent:
+        *      a trace event of a thread that exited.
+        */
+        struct RetiredTraceEvent {
+            int thread_id;
+            TraceEvent event;
+        };
+
+        static std::mutex registry_lock;
+        static std::vector<ThreadBlock*> thread_blocks;
+        static std::vector<uint64_t> retired_values;
+        static std::vector<RetiredTraceEvent> retired_trace_events;
+        static int next_thread_id;
+        static std::atomic<bool> is_tracing;
+        static std::atomic<std::chrono::steady_clock::rep> trace_start_ticks;
+
+        /**
+        * getThreadBlock: returns the block of the current thread, and creates it on the first call of the thread.
+        * @return the block of the current thread.
+        */
+        static ThreadBlock& getThreadBlock();
+        /**
+        * increment: adds an amount to a value of the block of the current thread.
+        * @param index : the index of the value.
+        * @param amount : the amount to add.
+        */
+        static void increment(int index, uint64_t amount);
+        /**
+        * getLatencyBucket: returns the histogram bucket of a duration.
+        * @param nanoseconds : the duration.
+        * @return the index of the bucket.
+        */
+        static int getLatencyBucket(uint64_t nanoseconds);
+        /**
+        * recordOperation: counts a timed operation of the current thread, and traces it if a trace is recorded.
+        * @param operation : the operation.
+        * @param start : the time the operation started.
+        * @param end : the time the operation ended.
+        */
+        static void recordOperation(InstrumentedOperation operation, std::chrono::steady_clock::time_point start,
+                                    std::chrono::steady_clock::time_point end);
+        /**
+        * writeTraceEvent: writes a trace event as a Chrome trace JSON object.
+        * @param os : the stream to write to.
+        * @param thread_id : the id of the thread of the event.
+        * @param event : the event.
+        * @param is_first : false to write a separating comma before the object.
+        */
+        static void writeTraceEvent(std::ostream& os, int thread_id, const TraceEvent& event, bool is_first);
+
+    public:
+        /**
+        * class ScopedOperation:
+        *      times an operation from its construction to its destruction.
+        */
+        class ScopedOperation {
+        private:
+            InstrumentedOperation operation;
+            std::chrono::steady_clock::time_point start;
+
+        public:
+            /**
+            * constructor of the scope that receives 1 parameter. starts timing the operation.
+            * @param operation : the operation.
+            */
+            explicit ScopedOperation(InstrumentedOperation operation);
+            ScopedOperation(const ScopedOperation& other) = delete;
+            ScopedOperation& operator=(const ScopedOperation& other) = delete;
+            /**
+            * ~ScopedOperation: stops timing the operation and records it.
+            */
+            ~ScopedOperation();
+        };
+
+        /**
+        * isCompiledIn: checks if the game was compiled with the instrumentation hooks.
+        * @return true if GAME_ENABLE_INSTRUMENTATION is defined.
+        */
+        static bool isCompiledIn();
+        /**
+        * addToCounter: adds an amount to a counter of the current thread.
+        * @param counter : the counter.
+        * @param amount : the amount to add.
+        */
+        static void addToCounter(InstrumentedCounter counter, uint64_t amount);
+        /**
+        * recordException: counts an exception that is about to be thrown.
+        * @param status : the status that matches the type of the exception.
+        */
+        static void recordException(ActionStatus status);
+        /**
+        * getSnapshot: sums the counters of all the threads, including the threads that exited.
+        * the counters of threads that are counting at the same time may be read in the middle of an operation.
+        * @param snapshot : set to the totals.
+        */
+        static void getSnapshot(InstrumentationSnapshot& snapshot);
+        /**
+        * reset: zeroes the counters of all the threads. must not run while operations are counted.
+        */
+        static void reset();
+        /**
+        * startTrace: discards the recorded trace events and starts recording new ones.
+        */
+        static void startTrace();
+        /**
+        * stopTrace: stops recording trace events. the recorded events are kept until the next startTrace.
+        */
+        static void stopTrace();
+        /**
+        * writeChromeTrace: writes the recorded trace events in the Chrome trace event JSON format. every operation
+        * is a complete ("X") event with its start and duration in microseconds, and the id of its thread.
+        * each thread keeps up to MAX_TRACE_EVENTS_PER_THREAD events of a trace - later events are dropped.
+        * @param os : the stream to write to.
+        */
+        static void writeChromeTrace(std::ostream& os);
+        /**
+        * saveChromeTrace: writes the recorded trace events to a file, replacing its content.
+        * @param path : the path of the file.
+        * possible errors:
+        *      - IllegalArgument : if the file cannot be written.
+        */
+        static void saveChromeTrace(const std::string& path);
+    };
+}
+
+#endif //GAME_PROJECT_INSTRUMENTATION_H
@@ -0,0 +1,33 @@
+#include "LittleEndian.h"
+
+namespace mtm
+{
+    void LittleEndian::writeUint32(std::vector<char>& data, uint32_t value) {
+        for (int i = 0; i < 4; i++)
+        {
+            data.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void LittleEndian::writeUint64(std::vector<char>& data, uint64_t value) {
+        writeUint32(data, static_cast<uint32_t>(value));
+        writeUint32(data, static_cast<uint32_t>(value >> 32));
+    }
+
+    void LittleEndian::overwriteUint64(char* data, uint64_t value) {
+        for (int i = 0; i < 8; i++)
+        {
+            data[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+    }
+
+    uint32_t LittleEndian::readUint32(const char* data) {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+               (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+    }
+
+    uint64_t LittleEndian::readUint64(const char* data) {
+        return static_cast<uint64_t>(readUint32(data)) | (static_cast<uint64_t>(readUint32(data + 4)) << 32);
+    }
+}
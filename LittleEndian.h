@@ -0,0 +1,47 @@
+#ifndef GAME_PROJECT_LITTLEENDIAN_H
+#define GAME_PROJECT_LITTLEENDIAN_H
+#include <vector>
+#include <cstdint>
+
+namespace mtm
+{
+    /**
+    * class LittleEndian:
+    *      reads and writes fixed size numbers in little endian byte order, for the binary formats of the game.
+    */
+    class LittleEndian {
+    public:
+        /**
+        * writeUint32: appends a 32 bit number to the data in little endian order.
+        * @param data : the data to append to.
+        * @param value : the number to append.
+        */
+        static void writeUint32(std::vector<char>& data, uint32_t value);
+        /**
+        * writeUint64: appends a 64 bit number to the data in little endian order.
+        * @param data : the data to append to.
+        * @param value : the number to append.
+        */
+        static void writeUint64(std::vector<char>& data, uint64_t value);
+        /**
+        * overwriteUint64: writes a 64 bit number in little endian order over existing bytes.
+        * @param data : pointer to the first of the 8 bytes to overwrite.
+        * @param value : the number to write.
+        */
+        static void overwriteUint64(char* data, uint64_t value);
+        /**
+        * readUint32: reads a 32 bit little endian number.
+        * @param data : pointer to the first byte of the number.
+        * @return the number.
+        */
+        static uint32_t readUint32(const char* data);
+        /**
+        * readUint64: reads a 64 bit little endian number.
+        * @param data : pointer to the first byte of the number.
+        * @return the number.
+        */
+        static uint64_t readUint64(const char* data);
+    };
+}
+
+#endif //GAME_PROJECT_LITTLEENDIAN_H
@@ -0,0 +1,129 @@
+#include "MatchRunner.h"
+#include <thread>
+#include <chrono>
+#include <exception>
+
+namespace mtm
+{
+    using std::vector;
+    using std::unique_ptr;
+
+    MatchRunner::MatchRunner(int num_of_threads) :
+            num_of_threads(num_of_threads), games_per_second(0)
+    {
+        if (num_of_threads < 0)
+        {
+            throw IllegalArgument();
+        }
+        if (num_of_threads == 0)
+        {
+            this->num_of_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+    }
+
+    int MatchRunner::getNumOfThreads() const {
+        return num_of_threads;
+    }
+
+    double MatchRunner::getGamesPerSecond() const {
+        return games_per_second;
+    }
+
+    bool MatchRunner::takeMatch(vector<unique_ptr<WorkerQueue>>& queues, int worker_index, int& match_index) {
+        {
+            WorkerQueue& own_queue = *queues[worker_index];
+            std::lock_guard<std::mutex> guard(own_queue.lock);
+            if (!own_queue.match_indices.empty())
+            {
+                match_index = own_queue.match_indices.back();
+                own_queue.match_indices.pop_back();
+                return true;
+            }
+        }
+        int num_of_queues = static_cast<int>(queues.size());
+        for (int i = 1; i < num_of_queues; i++)
+        {
+            WorkerQueue& victim_queue = *queues[(worker_index + i) % num_of_queues];
+            std::lock_guard<std::mutex> guard(victim_queue.lock);
+            if (!victim_queue.match_indices.empty())
+            {
+                match_index = victim_queue.match_indices.front();
+                victim_queue.match_indices.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    MatchResult MatchRunner::playMatch(int match_index, const GameFactory& game_factory,
+                                       const PolicyFactory& policy_factory, int max_turns) {
+        Game game = game_factory(match_index);
+        unique_ptr<TeamPolicy> policies[NUM_OF_TEAMS] = {policy_factory(match_index, POWERLIFTERS),
+                                                         policy_factory(match_index, CROSSFITTERS)};
+        MatchResult result = {match_index, false, POWERLIFTERS, 0};
+        while (!(result.is_over = game.isOver(&result.winning_team)) && result.num_of_turns < max_turns)
+        {
+            Team team = result.num_of_turns % NUM_OF_TEAMS == 0 ? POWERLIFTERS : CROSSFITTERS;
+            policies[team]->playTurn(game, team, result.num_of_turns);
+            result.num_of_turns++;
+        }
+        return result;
+    }
+
+    void MatchRunner::run(int num_of_matches, const GameFactory& game_factory, const PolicyFactory& policy_factory,
+                          int max_turns, vector<MatchResult>& results) {
+        if (num_of_matches < 0 || max_turns < 0)
+        {
+            throw IllegalArgument();
+        }
+        results.assign(num_of_matches, MatchResult());
+        int num_of_workers = std::max(1, std::min(num_of_threads, num_of_matches));
+        vector<unique_ptr<WorkerQueue>> queues;
+        for (int i = 0; i < num_of_workers; i++)
+        {
+            queues.push_back(unique_ptr<WorkerQueue>(new WorkerQueue()));
+        }
+        for (int match_index = 0; match_index < num_of_matches; match_index++)
+        {
+            queues[static_cast<long long>(match_index) * num_of_workers / num_of_matches]->match_indices.push_back(
+                    match_index);
+        }
+        std::mutex error_lock;
+        std::exception_ptr first_error;
+        auto worker = [&](int worker_index) {
+            int match_index = 0;
+            while (takeMatch(queues, worker_index, match_index))
+            {
+                try
+                {
+                    results[match_index] = playMatch(match_index, game_factory, policy_factory, max_turns);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> guard(error_lock);
+                    if (!first_error)
+                    {
+                        first_error = std::current_exception();
+                    }
+                }
+            }
+        };
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        vector<std::thread> threads;
+        for (int i = 1; i < num_of_workers; i++)
+        {
+            threads.push_back(std::thread(worker, i));
+        }
+        worker(0);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        games_per_second = seconds > 0 ? num_of_matches / seconds : 0;
+        if (first_error)
+        {
+            std::rethrow_exception(first_error);
+        }
+    }
+}
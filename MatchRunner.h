@@ -0,0 +1,118 @@
+#ifndef GAME_PROJECT_MATCHRUNNER_H
+#define GAME_PROJECT_MATCHRUNNER_H
+#include "TeamPolicy.h"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+namespace mtm
+{
+    /**
+    * struct MatchResult:
+    *      the outcome of a single match.
+    */
+    struct MatchResult {
+        int match_index;
+        bool is_over;
+        Team winning_team;
+        int num_of_turns;
+    };
+
+    /**
+    * class MatchRunner:
+    *      runs many independent matches concurrently on a pool of worker threads.
+    *      every match owns its game and its two team policies, which are created by factories given to run.
+    *      the matches are split evenly between per-worker queues. a worker takes matches from the back of its own
+    *      queue, and when it is empty it steals from the front of the queues of the other workers, so workers that
+    *      got short matches help the ones that got long matches.
+    *      thread safety: games and characters have no shared mutable state, so different games (including forks of
+    *      the same game, which share tiles until they are written) can be used from different threads concurrently.
+    *      a single game must not be used from two threads at once. the factories are called concurrently from the
+    *      worker threads and must be thread safe.
+    */
+    class MatchRunner {
+    public:
+        /**
+        * the factory of the game of a match, called with the index of the match.
+        */
+        typedef std::function<Game(int)> GameFactory;
+        /**
+        * the factory of the policy of a team in a match, called with the index of the match and the team.
+        */
+        typedef std::function<std::unique_ptr<TeamPolicy>(int, Team)> PolicyFactory;
+
+    private:
+        static const int NUM_OF_TEAMS = 2;
+
+        /**
+        * struct WorkerQueue:
+        *      the indices of the matches that are waiting for a worker.
+        */
+        struct WorkerQueue {
+            std::mutex lock;
+            std::deque<int> match_indices;
+        };
+
+        int num_of_threads;
+        double games_per_second;
+
+        /**
+        * takeMatch: takes a match for a worker - from the back of its own queue, or else from the front of the first
+        * non-empty queue of another worker.
+        * @param queues : the queues of all the workers.
+        * @param worker_index : the index of the worker.
+        * @param match_index : set to the index of the taken match.
+        * @return true if a match was taken, false if all the queues are empty.
+        */
+        static bool takeMatch(std::vector<std::unique_ptr<WorkerQueue>>& queues, int worker_index, int& match_index);
+        /**
+        * playMatch: plays a match until it is over or until the turn limit is reached.
+        * the teams play in turns, starting with POWERLIFTERS.
+        * @param match_index : the index of the match.
+        * @param game_factory : the factory of the game.
+        * @param policy_factory : the factory of the policies.
+        * @param max_turns : the turn limit.
+        * @return the result of the match.
+        */
+        static MatchResult playMatch(int match_index, const GameFactory& game_factory,
+                                     const PolicyFactory& policy_factory, int max_turns);
+
+    public:
+        /**
+        * constructor of the runner that receives 1 parameter.
+        * @param num_of_threads : the number of worker threads. 0 uses one thread for every hardware thread.
+        * possible errors:
+        *      - IllegalArgument : if the number of threads is negative.
+        */
+        explicit MatchRunner(int num_of_threads = 0);
+        /**
+        * getNumOfThreads: returns the number of worker threads.
+        * @return the number of worker threads.
+        */
+        int getNumOfThreads() const;
+        /**
+        * run: plays a number of matches and waits for all of them to finish.
+        * @param num_of_matches : the number of matches. the matches are indexed 0 to num_of_matches-1.
+        * @param game_factory : creates the game of every match.
+        * @param policy_factory : creates the policies of the teams in every match.
+        * @param max_turns : the number of turns after which a match that is not over is stopped.
+        * @param results : cleared and filled with the results of the matches, ordered by the match index.
+        * possible errors:
+        *      - IllegalArgument : if the number of matches or the turn limit is negative.
+        *      - any exception thrown by a factory or a policy. the remaining matches are still played, and the first
+        *        exception is rethrown when all the workers are done.
+        */
+        void run(int num_of_matches, const GameFactory& game_factory, const PolicyFactory& policy_factory,
+                 int max_turns, std::vector<MatchResult>& results);
+        /**
+        * getGamesPerSecond: returns the throughput of the last run.
+        * @return the number of matches that were played per second of wall time in the last run, or 0 if there
+        * was no run yet.
+        */
+        double getGamesPerSecond() const;
+    };
+}
+
+#endif //GAME_PROJECT_MATCHRUNNER_H
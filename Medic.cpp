@@ -1,4 +1,5 @@
 #include "Medic.h"
+#include "PoolAllocator.h"
 
 namespace mtm
 {
@@ -10,14 +11,19 @@ namespace mtm
 
     Medic::Medic(units_t health_points, units_t ammo_points, units_t range, units_t power, mtm::Team team) :
             Character(health_points, ammo_points,range, power, team, MEDIC_MOVEMENT_RANGE, MEDIC_RELOAD_AMMO_ADDITION,
-                      MEDIC_ATTACK_AMMO_COST, IDENTIFIER_CHAR_POWERLIFTERS, IDENTIFIER_CHAR_CROSSFITTERS){
+                      MEDIC_ATTACK_AMMO_COST, IDENTIFIER_CHAR_POWERLIFTERS, IDENTIFIER_CHAR_CROSSFITTERS,
+                      mtm::MEDIC){
     }
 
     std::shared_ptr<Character>Medic::clone() const {
-        return static_cast<std::shared_ptr<Character>>(new Medic(*this));
+        return std::allocate_shared<Medic>(PoolAllocator<Medic>(), *this);
     }
 
-    bool Medic::isCharacterHasEnoughAmmo(const std::shared_ptr<Character> &target_ptr) const {
+    units_t Medic::getCharacterStrikeAreaRadius() const {
+        return 0;
+    }
+
+    bool Medic::isCharacterHasEnoughAmmo(const Character* target_ptr) const {
         if (target_ptr == nullptr)
         {
             return (this->getCharacterAmmo() >= this->getCharacterAttackAmmoCost());
@@ -39,12 +45,12 @@ namespace mtm
     }
 
     bool Medic::isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
-                              std::shared_ptr<Character> target) const {
+                              const Character* target) const {
         return !(isTargetEmpty(target) || (src_coordinates == dst_coordinates));
     }
 
     units_t Medic::performStrike(const mtm::GridPoint &src_coordinates, const mtm::GridPoint &main_target_coordinates,
-                             const mtm::GridPoint &current_target_coordinates, std::shared_ptr<Character>target){
+                             const mtm::GridPoint &current_target_coordinates, const Character* target){
         if (!(main_target_coordinates == current_target_coordinates))
         {
             return 0;
@@ -8,9 +8,11 @@ namespace mtm
     /**
     * class Medic:
     *      represents the character of type Medic.
+    *      the class is final, so calls through a Medic reference are resolved at compile time.
     */
-    class Medic : public Character{
+    class Medic final : public Character{
     private:
+        friend class UnitStore;
         static const units_t MEDIC_MOVEMENT_RANGE;
         static const units_t MEDIC_RELOAD_AMMO_ADDITION;
         static const units_t MEDIC_ATTACK_AMMO_COST;
@@ -18,6 +20,9 @@ namespace mtm
         static const char IDENTIFIER_CHAR_CROSSFITTERS;
 
     public:
+        using Character::isCharacterHasEnoughAmmo;
+        using Character::isStrikeLegal;
+        using Character::performStrike;
         /**
         * constructor to medic that receives 5 parameters.
         * @param health_points : represents the life of the medic - when it gets to 0 the medic is dead.
@@ -48,12 +53,17 @@ namespace mtm
         */
         std::shared_ptr<Character> clone() const override;
         /**
+        * getCharacterStrikeAreaRadius: returns the radius of the medic strike around the main target.
+        * @return 0 - the medic strikes only its main target.
+        */
+        units_t getCharacterStrikeAreaRadius() const override;
+        /**
         * isCharacterHasEnoughAmmo : checks if the medic has enough ammo to perform attack.
         * @param target_ptr : pointer to the target.
         * @return true - if the target is team member of the medic or the medic itself.
         *         false - if the medic has less ammo than his attack's ammo cost.
         */
-        bool isCharacterHasEnoughAmmo(const std::shared_ptr<Character>& target_ptr) const override;
+        bool isCharacterHasEnoughAmmo(const Character* target_ptr) const override;
         /**
         * isTargetInStrikeRange: checks if the target is closer to the medic than his maximum attack range.
         * @param src_coordinates : the coordinates of the medic.
@@ -71,7 +81,7 @@ namespace mtm
         * @return true if the strike can be performed by the medic.
         */
         bool isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
-                           std::shared_ptr<Character> target) const override;
+                           const Character* target) const override;
         /**
         * performStrike: performs the medic strike. the medic attacks only one time in one place.
         * if his target is one of his teammates the attack is free and the medic heals him according to his power
@@ -85,7 +95,7 @@ namespace mtm
         * @return medic power if the target is his teammate. minus medic power if the target is his enemy.
         */
         units_t performStrike(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& main_target_coordinates,
-                          const mtm::GridPoint& current_target_coordinates, std::shared_ptr<Character> target)
+                          const mtm::GridPoint& current_target_coordinates, const Character* target)
                           override;
     };
 }
@@ -0,0 +1,277 @@
+#include "MonteCarloSearch.h"
+#include <cmath>
+#include <thread>
+#include <chrono>
+#include <exception>
+#include <algorithm>
+
+namespace mtm
+{
+    using std::vector;
+
+    MonteCarloSearch::MonteCarloSearch(int num_of_threads, int rollout_depth, unsigned int seed, double exploration) :
+            num_of_threads(num_of_threads), rollout_depth(rollout_depth), seed(seed), exploration(exploration),
+            rollouts_per_second(0)
+    {
+        if (num_of_threads < 0 || rollout_depth < 0 || exploration < 0)
+        {
+            throw IllegalArgument();
+        }
+        if (num_of_threads == 0)
+        {
+            this->num_of_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+    }
+
+    int MonteCarloSearch::getNumOfThreads() const {
+        return num_of_threads;
+    }
+
+    double MonteCarloSearch::getRolloutsPerSecond() const {
+        return rollouts_per_second;
+    }
+
+    Team MonteCarloSearch::getOtherTeam(Team team) {
+        return team == POWERLIFTERS ? CROSSFITTERS : POWERLIFTERS;
+    }
+
+    bool MonteCarloSearch::isActionBefore(const Action& first, const Action& second) {
+        const int first_key[] = {first.type, first.src_coordinates.row, first.src_coordinates.col,
+                                 first.dst_coordinates.row, first.dst_coordinates.col};
+        const int second_key[] = {second.type, second.src_coordinates.row, second.src_coordinates.col,
+                                  second.dst_coordinates.row, second.dst_coordinates.col};
+        return std::lexicographical_compare(first_key, first_key + 5, second_key, second_key + 5);
+    }
+
+    void MonteCarloSearch::appendUnitActions(const Game& game, const GridPoint& coordinates, vector<Action>& actions) {
+        vector<GridPoint> cells;
+        game.legalTargets(coordinates, cells);
+        for (const GridPoint& target : cells)
+        {
+            actions.push_back(Action(ATTACK_ACTION, coordinates, target));
+        }
+        game.legalMoves(coordinates, cells);
+        for (const GridPoint& destination : cells)
+        {
+            actions.push_back(Action(MOVE_ACTION, coordinates, destination));
+        }
+        actions.push_back(Action(RELOAD_ACTION, coordinates, coordinates));
+    }
+
+    void MonteCarloSearch::generateActions(const Game& game, Team team, UnitStore& units, vector<Action>& actions) {
+        actions.clear();
+        units.clear();
+        game.exportUnits(units);
+        for (int unit_id = 0; unit_id < units.getSize(); unit_id++)
+        {
+            if (units.getUnit(unit_id).getCharacterTeam() == team)
+            {
+                appendUnitActions(game, units.getUnitCoordinates(unit_id), actions);
+            }
+        }
+    }
+
+    double MonteCarloSearch::evaluate(const Game& game, Team team, UnitStore& units) {
+        Team winning_team = team;
+        if (game.isOver(&winning_team))
+        {
+            return winning_team == team ? 1 : 0;
+        }
+        units.clear();
+        game.exportUnits(units);
+        double team_health = 0;
+        double total_health = 0;
+        for (int unit_id = 0; unit_id < units.getSize(); unit_id++)
+        {
+            UnitView unit = units.getUnit(unit_id);
+            total_health += unit.getCharacterHealthPoints();
+            if (unit.getCharacterTeam() == team)
+            {
+                team_health += unit.getCharacterHealthPoints();
+            }
+        }
+        return total_health > 0 ? team_health / total_health : 0.5;
+    }
+
+    void MonteCarloSearch::playRollout(Game& game, Team team_to_act, std::mt19937& generator, UnitTracker& tracker,
+                                       vector<Action>& actions) const {
+        tracker.reset();
+        for (int depth = 0; depth < rollout_depth && !game.isOver(); depth++)
+        {
+            tracker.update(game);
+            const vector<GridPoint>& team_units = tracker.getUnits(team_to_act);
+            if (!team_units.empty())
+            {
+                std::uniform_int_distribution<size_t> pick_unit(0, team_units.size() - 1);
+                actions.clear();
+                appendUnitActions(game, team_units[pick_unit(generator)], actions);
+                std::uniform_int_distribution<size_t> pick_action(0, actions.size() - 1);
+                game.tryAction(actions[pick_action(generator)]);
+            }
+            team_to_act = getOtherTeam(team_to_act);
+        }
+    }
+
+    int MonteCarloSearch::selectChild(const vector<Node>& tree, int node) const {
+        double log_visits = std::log(static_cast<double>(tree[node].visits));
+        int best_child = tree[node].children[0];
+        double best_score = -1;
+        for (int child : tree[node].children)
+        {
+            double score = tree[child].total_reward / tree[child].visits +
+                           exploration * std::sqrt(log_visits / tree[child].visits);
+            if (score > best_score)
+            {
+                best_score = score;
+                best_child = child;
+            }
+        }
+        return best_child;
+    }
+
+    void MonteCarloSearch::growTree(const Game& game, Team team, int num_of_rollouts, unsigned int tree_seed,
+                                    vector<RootStatistics>& root_statistics) const {
+        std::mt19937 generator(tree_seed);
+        UnitStore units;
+        UnitTracker tracker;
+        vector<Action> actions;
+        vector<Node> tree;
+        Node root = {-1, Action(RELOAD_ACTION, GridPoint(0, 0), GridPoint(0, 0)), team, false, vector<Action>(),
+                     vector<int>(), 0, 0};
+        tree.push_back(root);
+        for (int rollout = 0; rollout < num_of_rollouts; rollout++)
+        {
+            Game position = game.fork();
+            int node = 0;
+            while (true)
+            {
+                Node& current = tree[node];
+                if (!current.are_actions_generated)
+                {
+                    if (!position.isOver())
+                    {
+                        generateActions(position, current.team_to_act, units, current.untried_actions);
+                    }
+                    current.are_actions_generated = true;
+                }
+                if (!current.untried_actions.empty() || current.children.empty())
+                {
+                    break;
+                }
+                node = selectChild(tree, node);
+                position.tryAction(tree[node].action);
+            }
+            if (!tree[node].untried_actions.empty())
+            {
+                vector<Action>& untried_actions = tree[node].untried_actions;
+                std::uniform_int_distribution<size_t> pick_action(0, untried_actions.size() - 1);
+                size_t action_index = pick_action(generator);
+                Action action = untried_actions[action_index];
+                untried_actions[action_index] = untried_actions.back();
+                untried_actions.pop_back();
+                position.tryAction(action);
+                Node child = {node, action, getOtherTeam(tree[node].team_to_act), false, vector<Action>(),
+                              vector<int>(), 0, 0};
+                tree.push_back(child);
+                int child_index = static_cast<int>(tree.size()) - 1;
+                tree[node].children.push_back(child_index);
+                node = child_index;
+            }
+            playRollout(position, tree[node].team_to_act, generator, tracker, actions);
+            double reward = evaluate(position, team, units);
+            for (; node != -1; node = tree[node].parent)
+            {
+                tree[node].visits++;
+                bool is_acted_by_team = tree[node].parent != -1 && tree[tree[node].parent].team_to_act == team;
+                tree[node].total_reward += is_acted_by_team ? reward : 1 - reward;
+            }
+        }
+        root_statistics.clear();
+        for (int child : tree[0].children)
+        {
+            RootStatistics statistics = {tree[child].action, tree[child].visits, tree[child].total_reward};
+            root_statistics.push_back(statistics);
+        }
+    }
+
+    bool MonteCarloSearch::search(const Game& game, Team team, int rollouts_per_thread, Action& best_action) {
+        if (rollouts_per_thread <= 0)
+        {
+            throw IllegalArgument();
+        }
+        if (game.isOver())
+        {
+            return false;
+        }
+        vector<vector<RootStatistics>> thread_statistics(num_of_threads);
+        vector<std::exception_ptr> thread_errors(num_of_threads);
+        auto worker = [&](int thread_index) {
+            try
+            {
+                growTree(game, team, rollouts_per_thread, seed + thread_index, thread_statistics[thread_index]);
+            }
+            catch (...)
+            {
+                thread_errors[thread_index] = std::current_exception();
+            }
+        };
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        vector<std::thread> threads;
+        for (int i = 1; i < num_of_threads; i++)
+        {
+            threads.push_back(std::thread(worker, i));
+        }
+        worker(0);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        rollouts_per_second = seconds > 0 ? rollouts_per_thread / seconds : 0;
+        for (const std::exception_ptr& error : thread_errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+        vector<RootStatistics> all_statistics;
+        for (const vector<RootStatistics>& statistics : thread_statistics)
+        {
+            all_statistics.insert(all_statistics.end(), statistics.begin(), statistics.end());
+        }
+        std::sort(all_statistics.begin(), all_statistics.end(),
+                  [](const RootStatistics& first, const RootStatistics& second) {
+                      return isActionBefore(first.action, second.action);
+                  });
+        vector<RootStatistics> merged_statistics;
+        for (const RootStatistics& action_statistics : all_statistics)
+        {
+            if (!merged_statistics.empty() &&
+                !isActionBefore(merged_statistics.back().action, action_statistics.action))
+            {
+                merged_statistics.back().visits += action_statistics.visits;
+                merged_statistics.back().total_reward += action_statistics.total_reward;
+            }
+            else
+            {
+                merged_statistics.push_back(action_statistics);
+            }
+        }
+        if (merged_statistics.empty())
+        {
+            return false;
+        }
+        const RootStatistics* best = &merged_statistics[0];
+        for (const RootStatistics& action_statistics : merged_statistics)
+        {
+            if (action_statistics.visits > best->visits ||
+                (action_statistics.visits == best->visits && action_statistics.total_reward > best->total_reward))
+            {
+                best = &action_statistics;
+            }
+        }
+        best_action = best->action;
+        return true;
+    }
+}
@@ -0,0 +1,160 @@
+#ifndef GAME_PROJECT_MONTECARLOSEARCH_H
+#define GAME_PROJECT_MONTECARLOSEARCH_H
+#include "Game.h"
+#include "UnitTracker.h"
+#include <vector>
+#include <random>
+
+namespace mtm
+{
+    /**
+    * class MonteCarloSearch:
+    *      chooses an action for a team with Monte Carlo tree search.
+    *      the teams act in turns, one action of one unit per turn. the actions of a position are generated with
+    *      legalMoves and legalTargets and applied with the non-throwing try methods, so no exception is thrown
+    *      during the search. every iteration plays on a fork of the searched game, which shares the unchanged
+    *      tiles of the board with it, so a rollout only copies the parts of the board it modifies.
+    *      the search is root-parallel - every thread grows its own tree from the searched game with its own seed,
+    *      and the visits of the root actions are summed over the trees to choose the action.
+    *      a rollout plays random actions until the game is over or the rollout depth is reached. a game that is
+    *      not over is scored by the share of the health points of the searching team on the board.
+    */
+    class MonteCarloSearch {
+    private:
+        /**
+        * struct Node:
+        *      a position in a search tree.
+        */
+        struct Node {
+            int parent;
+            Action action;
+            Team team_to_act;
+            bool are_actions_generated;
+            std::vector<Action> untried_actions;
+            std::vector<int> children;
+            int visits;
+            double total_reward;
+        };
+
+        /**
+        * struct RootStatistics:
+        *      the visits and rewards of an action of the searched position in one tree.
+        */
+        struct RootStatistics {
+            Action action;
+            int visits;
+            double total_reward;
+        };
+
+        int num_of_threads;
+        int rollout_depth;
+        unsigned int seed;
+        double exploration;
+        double rollouts_per_second;
+
+        /**
+        * getOtherTeam: returns the opponent of a team.
+        * @param team : the team.
+        * @return the other team.
+        */
+        static Team getOtherTeam(Team team);
+        /**
+        * isActionBefore: orders actions by their type and coordinates, so equal actions of different trees can be
+        * merged.
+        * @return true if the first action is ordered before the second one.
+        */
+        static bool isActionBefore(const Action& first, const Action& second);
+        /**
+        * appendUnitActions: adds every legal action of a unit.
+        * @param game : the position.
+        * @param coordinates : the coordinates of the unit.
+        * @param actions : the list to add the actions to.
+        */
+        static void appendUnitActions(const Game& game, const GridPoint& coordinates, std::vector<Action>& actions);
+        /**
+        * generateActions: lists every legal action of a team.
+        * @param game : the position.
+        * @param team : the team to act.
+        * @param units : a store to export the units of the game into.
+        * @param actions : cleared and filled with the actions.
+        */
+        static void generateActions(const Game& game, Team team, UnitStore& units, std::vector<Action>& actions);
+        /**
+        * evaluate: scores a position for a team.
+        * @param game : the position.
+        * @param team : the team to score the position for.
+        * @param units : a store to export the units of the game into.
+        * @return 1 if the team won, 0 if it lost, and otherwise its share of the health points on the board.
+        */
+        static double evaluate(const Game& game, Team team, UnitStore& units);
+        /**
+        * playRollout: plays random actions from a position until the game is over or the depth is reached.
+        * the units of the teams are exported once at the start of the rollout, and then follow the changes of the
+        * board.
+        * @param game : the position. modified by the rollout.
+        * @param team_to_act : the team that acts first.
+        * @param generator : the random generator of the thread.
+        * @param tracker : a tracker for the units of the teams. reset by the rollout, since the position of every
+        * rollout is a new game.
+        * @param actions : a buffer for the actions of a unit.
+        */
+        void playRollout(Game& game, Team team_to_act, std::mt19937& generator, UnitTracker& tracker,
+                         std::vector<Action>& actions) const;
+        /**
+        * selectChild: returns the child of a node with the highest upper confidence bound.
+        * @param tree : the nodes of the tree.
+        * @param node : index of a node with children.
+        * @return index of the selected child.
+        */
+        int selectChild(const std::vector<Node>& tree, int node) const;
+        /**
+        * growTree: runs iterations of the search on a tree of its own.
+        * @param game : the searched position.
+        * @param team : the searching team.
+        * @param num_of_rollouts : the number of iterations.
+        * @param tree_seed : the seed of the tree.
+        * @param root_statistics : filled with the statistics of the actions of the root.
+        */
+        void growTree(const Game& game, Team team, int num_of_rollouts, unsigned int tree_seed,
+                      std::vector<RootStatistics>& root_statistics) const;
+
+    public:
+        /**
+        * constructor of the search that receives 4 parameters.
+        * @param num_of_threads : the number of trees that are grown in parallel. 0 uses one for every hardware
+        * thread.
+        * @param rollout_depth : the maximal number of actions in a rollout.
+        * @param seed : the seed of the random choices. a search with the same parameters on the same number of
+        * threads always chooses the same action.
+        * @param exploration : the exploration constant of the upper confidence bound.
+        * possible errors:
+        *      - IllegalArgument : if the number of threads or the rollout depth is negative, or the exploration
+        *        constant is negative.
+        */
+        MonteCarloSearch(int num_of_threads, int rollout_depth, unsigned int seed, double exploration = 1.4);
+        /**
+        * search: chooses an action for a team.
+        * @param game : the position to search. it is not modified, and must not be modified during the search.
+        * @param team : the team to choose an action for.
+        * @param rollouts_per_thread : the number of iterations of every tree.
+        * @param best_action : set to the action with the most visits over all the trees.
+        * @return false if the game is over or the team has no units, in which case best_action is not changed.
+        * possible errors:
+        *      - IllegalArgument : if the number of iterations is not positive.
+        */
+        bool search(const Game& game, Team team, int rollouts_per_thread, Action& best_action);
+        /**
+        * getNumOfThreads: returns the number of trees that are grown in parallel.
+        * @return the number of threads.
+        */
+        int getNumOfThreads() const;
+        /**
+        * getRolloutsPerSecond: returns the throughput of the last search.
+        * @return the number of rollouts per second of wall time of a single thread - the rollouts of all the
+        * threads per second, divided by the number of threads - or 0 before the first search.
+        */
+        double getRolloutsPerSecond() const;
+    };
+}
+
+#endif //GAME_PROJECT_MONTECARLOSEARCH_H
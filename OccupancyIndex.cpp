@@ -0,0 +1,45 @@
+#include "OccupancyIndex.h"
+
+namespace mtm
+{
+    const int OccupancyIndex::BITS_PER_WORD = 64;
+
+    OccupancyIndex::OccupancyIndex(int height, int width) :
+            words_per_row(width / BITS_PER_WORD + (width % BITS_PER_WORD == 0 ? 0 : 1)),
+            words(static_cast<size_t>(height) * words_per_row, 0)
+    {}
+
+    int OccupancyIndex::getWordIndex(const GridPoint& coordinates) const {
+        return coordinates.row * words_per_row + coordinates.col / BITS_PER_WORD;
+    }
+
+    uint64_t OccupancyIndex::getBitMask(const GridPoint& coordinates) {
+        return uint64_t(1) << (coordinates.col % BITS_PER_WORD);
+    }
+
+    int OccupancyIndex::getLowestSetBit(uint64_t word) {
+#if defined(__GNUC__)
+        return __builtin_ctzll(word);
+#else
+        int bit = 0;
+        while ((word & 1) == 0)
+        {
+            word >>= 1;
+            bit++;
+        }
+        return bit;
+#endif
+    }
+
+    void OccupancyIndex::markOccupied(const GridPoint& coordinates) {
+        words[getWordIndex(coordinates)] |= getBitMask(coordinates);
+    }
+
+    void OccupancyIndex::markEmpty(const GridPoint& coordinates) {
+        words[getWordIndex(coordinates)] &= ~getBitMask(coordinates);
+    }
+
+    bool OccupancyIndex::isOccupied(const GridPoint& coordinates) const {
+        return (words[getWordIndex(coordinates)] & getBitMask(coordinates)) != 0;
+    }
+}
@@ -0,0 +1,140 @@
+#ifndef GAME_PROJECT_OCCUPANCYINDEX_H
+#define GAME_PROJECT_OCCUPANCYINDEX_H
+#include "Auxiliaries.h"
+#include <vector>
+#include <cstdint>
+
+namespace mtm
+{
+    /**
+    * class OccupancyIndex:
+    *      a bitboard of the occupied cells of a game board.
+    *      every row is stored in its own run of 64 bit words, so a span of a row can be scanned a word at a time
+    *      and only the occupied cells inside it are visited.
+    */
+    class OccupancyIndex {
+    private:
+        static const int BITS_PER_WORD;
+        int words_per_row;
+        std::vector<uint64_t> words;
+
+        /**
+        * getWordIndex: returns the index of the word that holds the bit of the given cell.
+        * @param coordinates : coordinates inside the board.
+        * @return index of the word in the words array.
+        */
+        int getWordIndex(const GridPoint& coordinates) const;
+        /**
+        * getBitMask: returns the mask of the bit of the given cell inside its word.
+        * @param coordinates : coordinates inside the board.
+        * @return word with only the bit of the cell set.
+        */
+        static uint64_t getBitMask(const GridPoint& coordinates);
+        /**
+        * getLowestSetBit: returns the position of the lowest set bit of a non zero word.
+        * @param word : the word to check, must be different than 0.
+        * @return position of the lowest set bit.
+        */
+        static int getLowestSetBit(uint64_t word);
+        /**
+        * forEachMatchingInRow: calls the visitor with the column of every cell in a span of a row whose bit,
+        * flipped by the given mask, is set.
+        * @param row : the row to scan, must be inside the board.
+        * @param first_col : first column of the span, must be inside the board.
+        * @param last_col : last column of the span (inclusive), must be inside the board.
+        * @param flip_mask : 0 to visit the occupied cells, all ones to visit the empty cells.
+        * @param visitor : callable that receives the column of a matching cell.
+        */
+        template <class Visitor>
+        void forEachMatchingInRow(int row, int first_col, int last_col, uint64_t flip_mask, Visitor visitor) const;
+
+    public:
+        /**
+        * constructor of the index that receives 2 parameters. all the cells start empty.
+        * @param height : number of rows in the board.
+        * @param width : number of columns in the board.
+        */
+        OccupancyIndex(int height, int width);
+        /**
+        * markOccupied: marks the cell at the given coordinates as occupied.
+        * @param coordinates : coordinates inside the board.
+        */
+        void markOccupied(const GridPoint& coordinates);
+        /**
+        * markEmpty: marks the cell at the given coordinates as empty.
+        * @param coordinates : coordinates inside the board.
+        */
+        void markEmpty(const GridPoint& coordinates);
+        /**
+        * isOccupied: checks if the cell at the given coordinates is marked as occupied.
+        * @param coordinates : coordinates inside the board.
+        * @return true if the cell is occupied.
+        */
+        bool isOccupied(const GridPoint& coordinates) const;
+        /**
+        * forEachOccupiedInRow: calls the visitor with the column of every occupied cell in a span of a row,
+        * from left to right. the visitor may mark the visited cell as empty.
+        * @param row : the row to scan, must be inside the board.
+        * @param first_col : first column of the span, must be inside the board.
+        * @param last_col : last column of the span (inclusive), must be inside the board.
+        * @param visitor : callable that receives the column of an occupied cell.
+        */
+        template <class Visitor>
+        void forEachOccupiedInRow(int row, int first_col, int last_col, Visitor visitor) const;
+        /**
+        * forEachEmptyInRow: calls the visitor with the column of every empty cell in a span of a row, from left to
+        * right.
+        * @param row : the row to scan, must be inside the board.
+        * @param first_col : first column of the span, must be inside the board.
+        * @param last_col : last column of the span (inclusive), must be inside the board.
+        * @param visitor : callable that receives the column of an empty cell.
+        */
+        template <class Visitor>
+        void forEachEmptyInRow(int row, int first_col, int last_col, Visitor visitor) const;
+    };
+
+    template <class Visitor>
+    void OccupancyIndex::forEachOccupiedInRow(int row, int first_col, int last_col, Visitor visitor) const
+    {
+        forEachMatchingInRow(row, first_col, last_col, 0, visitor);
+    }
+
+    template <class Visitor>
+    void OccupancyIndex::forEachEmptyInRow(int row, int first_col, int last_col, Visitor visitor) const
+    {
+        forEachMatchingInRow(row, first_col, last_col, ~uint64_t(0), visitor);
+    }
+
+    template <class Visitor>
+    void OccupancyIndex::forEachMatchingInRow(int row, int first_col, int last_col, uint64_t flip_mask,
+                                              Visitor visitor) const
+    {
+        if (first_col > last_col)
+        {
+            return;
+        }
+        const uint64_t* row_words = words.data() + static_cast<size_t>(row) * words_per_row;
+        int first_word = first_col / BITS_PER_WORD;
+        int last_word = last_col / BITS_PER_WORD;
+        for (int w = first_word; w <= last_word; w++)
+        {
+            uint64_t word = row_words[w] ^ flip_mask;
+            if (w == first_word)
+            {
+                word &= (~uint64_t(0)) << (first_col % BITS_PER_WORD);
+            }
+            if (w == last_word)
+            {
+                word &= (~uint64_t(0)) >> (BITS_PER_WORD - 1 - (last_col % BITS_PER_WORD));
+            }
+            while (word != 0)
+            {
+                int bit = getLowestSetBit(word);
+                word &= word - 1;
+                visitor(w * BITS_PER_WORD + bit);
+            }
+        }
+    }
+}
+
+#endif //GAME_PROJECT_OCCUPANCYINDEX_H
@@ -0,0 +1,56 @@
+#ifndef GAME_PROJECT_POOLALLOCATOR_H
+#define GAME_PROJECT_POOLALLOCATOR_H
+#include "CharacterPool.h"
+#include <cstddef>
+
+namespace mtm
+{
+    /**
+    * class PoolAllocator:
+    *      a standard allocator that takes its memory from the CharacterPool.
+    *      it is meant for std::allocate_shared, which places the object and its control block in a single pool block.
+    */
+    template <class T>
+    class PoolAllocator {
+    public:
+        typedef T value_type;
+
+        PoolAllocator() = default;
+        /**
+        * converting constructor from an allocator of another type. all the pool allocators are interchangeable.
+        */
+        template <class U>
+        PoolAllocator(const PoolAllocator<U>&)
+        {}
+        /**
+        * allocate: allocates uninitialized room for objects.
+        * @param num_of_objects : the number of objects.
+        * @return pointer to the room.
+        */
+        T* allocate(std::size_t num_of_objects) {
+            static_assert(alignof(T) <= alignof(std::max_align_t),
+                          "pool blocks are aligned only for fundamental types");
+            return static_cast<T*>(CharacterPool::allocate(num_of_objects * sizeof(T)));
+        }
+        /**
+        * deallocate: frees room that was allocated by allocate.
+        * @param objects : pointer to the room.
+        * @param num_of_objects : the number of objects it was allocated for.
+        */
+        void deallocate(T* objects, std::size_t num_of_objects) {
+            CharacterPool::deallocate(objects, num_of_objects * sizeof(T));
+        }
+    };
+
+    template <class T, class U>
+    bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+        return true;
+    }
+
+    template <class T, class U>
+    bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+        return false;
+    }
+}
+
+#endif //GAME_PROJECT_POOLALLOCATOR_H
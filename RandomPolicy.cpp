@@ -0,0 +1,50 @@
+#include "RandomPolicy.h"
+#include <cstdlib>
+
+namespace mtm
+{
+    using std::vector;
+
+    RandomPolicy::RandomPolicy(unsigned int seed) :
+            generator(seed), tracker()
+    {}
+
+    GridPoint RandomPolicy::pickRandom(const vector<GridPoint>& units) {
+        std::uniform_int_distribution<size_t> distribution(0, units.size() - 1);
+        return units[distribution(generator)];
+    }
+
+    GridPoint RandomPolicy::getStepTowards(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                           units_t movement_range) {
+        GridPoint step = src_coordinates;
+        int row_distance = dst_coordinates.row - src_coordinates.row;
+        int row_step = std::min(std::abs(row_distance), movement_range);
+        step.row += row_distance < 0 ? -row_step : row_step;
+        int col_distance = dst_coordinates.col - src_coordinates.col;
+        int col_step = std::min(std::abs(col_distance), movement_range - row_step);
+        step.col += col_distance < 0 ? -col_step : col_step;
+        return step;
+    }
+
+    void RandomPolicy::playTurn(Game& game, Team team, int) {
+        tracker.update(game);
+        const vector<GridPoint>& own_units = tracker.getUnits(team);
+        const vector<GridPoint>& enemy_units = tracker.getUnits(team == POWERLIFTERS ? CROSSFITTERS : POWERLIFTERS);
+        if (own_units.empty() || enemy_units.empty())
+        {
+            return;
+        }
+        GridPoint src_coordinates = pickRandom(own_units);
+        GridPoint dst_coordinates = pickRandom(enemy_units);
+        ActionStatus status = game.tryAttack(src_coordinates, dst_coordinates);
+        if (status == ACTION_OUT_OF_AMMO)
+        {
+            game.tryReload(src_coordinates);
+        }
+        else if (status != ACTION_SUCCESS)
+        {
+            units_t movement_range = game.getCharacter(src_coordinates)->getCharacterMovementRange();
+            game.tryMove(src_coordinates, getStepTowards(src_coordinates, dst_coordinates, movement_range));
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef GAME_PROJECT_RANDOMPOLICY_H
+#define GAME_PROJECT_RANDOMPOLICY_H
+#include "TeamPolicy.h"
+#include "UnitTracker.h"
+#include <random>
+#include <vector>
+
+namespace mtm
+{
+    /**
+    * class RandomPolicy
+    * inherits from class TeamPolicy.
+    * in every turn a random unit of the team attacks a random enemy unit. if the attack fails the unit reloads when
+    * it is out of ammo, and otherwise steps towards the enemy unit.
+    * the choices depend only on the seed, so a match played by random policies is reproducible.
+    * the units of the teams are tracked through the changes of the board, so a turn does not scan the board.
+    * a policy follows the game of a single match.
+    */
+    class RandomPolicy : public TeamPolicy {
+    private:
+        std::mt19937 generator;
+        UnitTracker tracker;
+
+        /**
+        * pickRandom: returns a random element of a non-empty vector of unit coordinates.
+        * @param units : the coordinates to pick from.
+        * @return the picked coordinates.
+        */
+        GridPoint pickRandom(const std::vector<GridPoint>& units);
+        /**
+        * getStepTowards: returns the farthest cell a unit can move to on the way to a target, moving along the row
+        * first and then along the column.
+        * @param src_coordinates : the coordinates of the unit.
+        * @param dst_coordinates : the coordinates of the target.
+        * @param movement_range : the movement range of the unit.
+        * @return the coordinates to move to.
+        */
+        static GridPoint getStepTowards(const GridPoint& src_coordinates, const GridPoint& dst_coordinates,
+                                        units_t movement_range);
+
+    public:
+        /**
+        * constructor of the policy that receives 1 parameter.
+        * @param seed : the seed of the random choices.
+        */
+        explicit RandomPolicy(unsigned int seed);
+        void playTurn(Game& game, Team team, int turn) override;
+    };
+}
+
+#endif //GAME_PROJECT_RANDOMPOLICY_H
@@ -0,0 +1,422 @@
+#include "Simulation.h"
+#include "MatchRunner.h"
+#include "TeamPolicy.h"
+#include "UnitTracker.h"
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
+
+namespace mtm
+{
+    using std::vector;
+    using std::string;
+    using std::unique_ptr;
+
+    SimulationConfig::SimulationConfig() :
+            height(64), width(64), density(0.25), soldier_weight(1), medic_weight(1), sniper_weight(1), health(10),
+            ammo(5), range(4), power(2), num_of_matches(16), max_turns(1000), seed(1), num_of_threads(0),
+            num_of_copies(100), num_of_renders(100), script_path()
+    {}
+
+    /**
+    * class Simulation::RandomActionPolicy
+    * inherits from class TeamPolicy.
+    * acts with a random unit of the team in every turn, and counts the successful actions of the match.
+    * the units of the teams are tracked through the changes of the board, so a turn does not scan the board.
+    */
+    class Simulation::RandomActionPolicy : public TeamPolicy {
+    private:
+        std::mt19937 generator;
+        ActionCounts& counts;
+        UnitTracker tracker;
+        vector<GridPoint> cells;
+
+        /**
+        * pickRandom: returns a random index of a non-empty vector.
+        * @param size : the size of the vector.
+        * @return the index.
+        */
+        size_t pickRandom(size_t size) {
+            std::uniform_int_distribution<size_t> distribution(0, size - 1);
+            return distribution(generator);
+        }
+
+    public:
+        /**
+        * constructor of the policy that receives 2 parameters.
+        * @param seed : the seed of the random choices.
+        * @param counts : the counters of the match to add the successful actions to.
+        */
+        RandomActionPolicy(unsigned int seed, ActionCounts& counts) :
+                generator(seed), counts(counts), tracker(), cells()
+        {}
+
+        void playTurn(Game& game, Team team, int) override {
+            tracker.update(game);
+            const vector<GridPoint>& own_units = tracker.getUnits(team);
+            if (own_units.empty())
+            {
+                return;
+            }
+            GridPoint src_coordinates = own_units[pickRandom(own_units.size())];
+            ActionStatus status = ACTION_SUCCESS;
+            game.legalTargets(src_coordinates, cells);
+            if (!cells.empty())
+            {
+                status = game.tryAttack(src_coordinates, cells[pickRandom(cells.size())]);
+                counts.num_of_attacks += (status == ACTION_SUCCESS);
+            }
+            else
+            {
+                game.legalMoves(src_coordinates, cells);
+                if (cells.empty() || game.getCharacter(src_coordinates)->getCharacterAmmo() <= 0)
+                {
+                    status = game.tryReload(src_coordinates);
+                }
+                else
+                {
+                    status = game.tryMove(src_coordinates, cells[pickRandom(cells.size())]);
+                }
+            }
+            counts.num_of_actions += (status == ACTION_SUCCESS);
+        }
+    };
+
+    /**
+    * class Simulation::ScriptPolicy
+    * inherits from class TeamPolicy.
+    * plays the action of the script that matches the turn, whichever team is playing it, and counts the successful
+    * actions of the match.
+    */
+    class Simulation::ScriptPolicy : public TeamPolicy {
+    private:
+        const vector<Action>& script;
+        ActionCounts& counts;
+
+    public:
+        /**
+        * constructor of the policy that receives 2 parameters.
+        * @param script : the actions of the script.
+        * @param counts : the counters of the match to add the successful actions to.
+        */
+        ScriptPolicy(const vector<Action>& script, ActionCounts& counts) : script(script), counts(counts)
+        {}
+
+        void playTurn(Game& game, Team, int turn) override {
+            if (turn >= static_cast<int>(script.size()))
+            {
+                return;
+            }
+            const Action& action = script[turn];
+            if (game.tryAction(action) == ACTION_SUCCESS)
+            {
+                counts.num_of_actions++;
+                counts.num_of_attacks += (action.type == ATTACK_ACTION);
+            }
+        }
+    };
+
+    Simulation::Simulation(const SimulationConfig& config) : config(config), script()
+    {
+        if (config.height <= 0 || config.width <= 0 || !(config.density >= 0 && config.density <= 1) ||
+            config.soldier_weight < 0 || config.medic_weight < 0 || config.sniper_weight < 0 ||
+            config.soldier_weight + config.medic_weight + config.sniper_weight <= 0 || config.health <= 0 ||
+            config.ammo < 0 || config.range < 0 || config.power < 0 || config.num_of_matches < 0 ||
+            config.max_turns < 0 || config.num_of_threads < 0 || config.num_of_copies < 0 ||
+            config.num_of_renders < 0)
+        {
+            throw IllegalArgument();
+        }
+        if (!config.script_path.empty())
+        {
+            loadScript(config.script_path, script);
+        }
+    }
+
+    Game Simulation::generateBoard() const {
+        Game game(config.height, config.width);
+        std::mt19937 generator(config.seed);
+        std::bernoulli_distribution is_occupied(config.density);
+        std::discrete_distribution<int> type_distribution({static_cast<double>(config.soldier_weight),
+                                                           static_cast<double>(config.medic_weight),
+                                                           static_cast<double>(config.sniper_weight)});
+        std::uniform_int_distribution<int> team_distribution(POWERLIFTERS, CROSSFITTERS);
+        for (int r = 0; r < config.height; r++)
+        {
+            for (int c = 0; c < config.width; c++)
+            {
+                if (!is_occupied(generator))
+                {
+                    continue;
+                }
+                CharacterType type = static_cast<CharacterType>(type_distribution(generator));
+                Team team = static_cast<Team>(team_distribution(generator));
+                game.addCharacter(GridPoint(r, c), Game::makeCharacter(type, team, config.health, config.ammo,
+                                                                       config.range, config.power));
+            }
+        }
+        return game;
+    }
+
+    template <class Operation>
+    double Simulation::timeBoardOperation(int num_of_repeats, const Operation& operation) {
+        if (num_of_repeats == 0)
+        {
+            return 0;
+        }
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_of_repeats; i++)
+        {
+            operation();
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+               num_of_repeats;
+    }
+
+    SimulationReport Simulation::run() const {
+        const Game board = generateBoard();
+        vector<ActionCounts> match_counts(config.num_of_matches, ActionCounts());
+        bool is_scripted = !config.script_path.empty();
+        unsigned int seed = config.seed;
+        const vector<Action>& actions = script;
+        MatchRunner::GameFactory game_factory = [&board](int) {
+            return board.fork();
+        };
+        MatchRunner::PolicyFactory policy_factory = [&](int match_index, Team team) -> unique_ptr<TeamPolicy> {
+            if (is_scripted)
+            {
+                return unique_ptr<TeamPolicy>(new ScriptPolicy(actions, match_counts[match_index]));
+            }
+            std::seed_seq policy_seed = {seed, static_cast<unsigned int>(match_index), static_cast<unsigned int>(team)};
+            vector<unsigned int> policy_seeds(1);
+            policy_seed.generate(policy_seeds.begin(), policy_seeds.end());
+            return unique_ptr<TeamPolicy>(new RandomActionPolicy(policy_seeds[0], match_counts[match_index]));
+        };
+        int max_turns = is_scripted ? static_cast<int>(script.size()) : config.max_turns;
+        MatchRunner runner(config.num_of_threads);
+        vector<MatchResult> results;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        runner.run(config.num_of_matches, game_factory, policy_factory, max_turns, results);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        SimulationReport report = SimulationReport();
+        report.num_of_matches = config.num_of_matches;
+        for (int i = 0; i < config.num_of_matches; i++)
+        {
+            report.num_of_finished_matches += results[i].is_over;
+            report.num_of_turns += results[i].num_of_turns;
+            report.num_of_actions += match_counts[i].num_of_actions;
+            report.num_of_attacks += match_counts[i].num_of_attacks;
+        }
+        report.seconds = seconds;
+        report.actions_per_second = seconds > 0 ? report.num_of_actions / seconds : 0;
+        report.attacks_per_second = seconds > 0 ? report.num_of_attacks / seconds : 0;
+        report.copy_microseconds = timeBoardOperation(config.num_of_copies, [&board]() {
+            Game copy(board);
+        });
+        report.fork_microseconds = timeBoardOperation(config.num_of_copies, [&board]() {
+            Game fork = board.fork();
+        });
+        std::ostringstream rendered;
+        report.render_microseconds = timeBoardOperation(config.num_of_renders, [&board, &rendered]() {
+            rendered.str(string());
+            rendered << board;
+        });
+        return report;
+    }
+
+    void Simulation::loadScript(const string& path, vector<Action>& actions) {
+        std::ifstream file(path.c_str());
+        if (!file)
+        {
+            throw IllegalArgument();
+        }
+        actions.clear();
+        string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            string name;
+            if (!(fields >> name) || name[0] == '#')
+            {
+                continue;
+            }
+            GridPoint src_coordinates(0, 0);
+            GridPoint dst_coordinates(0, 0);
+            ActionType type = RELOAD_ACTION;
+            bool is_valid = false;
+            if (name == "move" || name == "attack")
+            {
+                type = (name == "move") ? MOVE_ACTION : ATTACK_ACTION;
+                is_valid = static_cast<bool>(fields >> src_coordinates.row >> src_coordinates.col >>
+                                             dst_coordinates.row >> dst_coordinates.col);
+            }
+            else if (name == "reload")
+            {
+                is_valid = static_cast<bool>(fields >> src_coordinates.row >> src_coordinates.col);
+            }
+            string extra;
+            if (!is_valid || (fields >> extra))
+            {
+                throw IllegalArgument();
+            }
+            actions.push_back(Action(type, src_coordinates, dst_coordinates));
+        }
+    }
+
+    void Simulation::printReport(std::ostream& os, const SimulationReport& report) {
+        os << "matches: " << report.num_of_matches << "\n"
+           << "finished matches: " << report.num_of_finished_matches << "\n"
+           << "turns: " << report.num_of_turns << "\n"
+           << "actions: " << report.num_of_actions << "\n"
+           << "attacks: " << report.num_of_attacks << "\n"
+           << "seconds: " << report.seconds << "\n"
+           << "actions/second: " << report.actions_per_second << "\n"
+           << "attacks/second: " << report.attacks_per_second << "\n"
+           << "copy microseconds: " << report.copy_microseconds << "\n"
+           << "fork microseconds: " << report.fork_microseconds << "\n"
+           << "render microseconds: " << report.render_microseconds << std::endl;
+    }
+
+    void Simulation::printUsage(std::ostream& os) {
+        os << "options (each followed by a value):\n"
+           << "  --height, --width      board size\n"
+           << "  --density              share of occupied cells, 0 to 1\n"
+           << "  --soldiers, --medics, --snipers\n"
+           << "                         relative weights of the character types\n"
+           << "  --health, --ammo, --range, --power\n"
+           << "                         stats of the generated characters\n"
+           << "  --matches              number of matches\n"
+           << "  --turns                turn limit of a random match\n"
+           << "  --seed                 seed of the board and the random matches\n"
+           << "  --threads              worker threads, 0 for one per hardware thread\n"
+           << "  --copies               number of timed copies and forks of the board\n"
+           << "  --renders              number of timed prints of the board\n"
+           << "  --script               file of actions to play instead of random matches" << std::endl;
+    }
+
+    bool Simulation::parseInt(const char* text, int& value) {
+        char* end = nullptr;
+        errno = 0;
+        long parsed = std::strtol(text, &end, 10);
+        if (end == text || *end != '\0' || errno != 0 || parsed < INT_MIN || parsed > INT_MAX)
+        {
+            return false;
+        }
+        value = static_cast<int>(parsed);
+        return true;
+    }
+
+    bool Simulation::parseOption(const string& name, const char* value, SimulationConfig& config) {
+        if (name == "--density")
+        {
+            char* end = nullptr;
+            config.density = std::strtod(value, &end);
+            return (end != value && *end == '\0');
+        }
+        if (name == "--script")
+        {
+            config.script_path = value;
+            return true;
+        }
+        int number = 0;
+        if (!parseInt(value, number))
+        {
+            return false;
+        }
+        if (name == "--height")
+        {
+            config.height = number;
+        }
+        else if (name == "--width")
+        {
+            config.width = number;
+        }
+        else if (name == "--soldiers")
+        {
+            config.soldier_weight = number;
+        }
+        else if (name == "--medics")
+        {
+            config.medic_weight = number;
+        }
+        else if (name == "--snipers")
+        {
+            config.sniper_weight = number;
+        }
+        else if (name == "--health")
+        {
+            config.health = number;
+        }
+        else if (name == "--ammo")
+        {
+            config.ammo = number;
+        }
+        else if (name == "--range")
+        {
+            config.range = number;
+        }
+        else if (name == "--power")
+        {
+            config.power = number;
+        }
+        else if (name == "--matches")
+        {
+            config.num_of_matches = number;
+        }
+        else if (name == "--turns")
+        {
+            config.max_turns = number;
+        }
+        else if (name == "--seed")
+        {
+            config.seed = static_cast<unsigned int>(number);
+        }
+        else if (name == "--threads")
+        {
+            config.num_of_threads = number;
+        }
+        else if (name == "--copies")
+        {
+            config.num_of_copies = number;
+        }
+        else if (name == "--renders")
+        {
+            config.num_of_renders = number;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    int Simulation::runCli(int argc, const char* const argv[], std::ostream& os) {
+        SimulationConfig config;
+        for (int i = 1; i < argc; i += 2)
+        {
+            if (i + 1 >= argc || !parseOption(argv[i], argv[i + 1], config))
+            {
+                os << "invalid option: " << argv[i] << std::endl;
+                printUsage(os);
+                return 1;
+            }
+        }
+        try
+        {
+            Simulation simulation(config);
+            printReport(os, simulation.run());
+        }
+        catch (const IllegalArgument&)
+        {
+            os << "invalid simulation parameters or script" << std::endl;
+            printUsage(os);
+            return 1;
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,168 @@
+#ifndef GAME_PROJECT_SIMULATION_H
+#define GAME_PROJECT_SIMULATION_H
+#include "Game.h"
+#include "Action.h"
+#include <vector>
+#include <string>
+#include <iostream>
+
+namespace mtm
+{
+    /**
+    * struct SimulationConfig:
+    *      the parameters of a simulation run - the board to generate, the matches to play on it and the
+    *      measurements to take.
+    */
+    struct SimulationConfig {
+        int height;
+        int width;
+        double density;
+        int soldier_weight;
+        int medic_weight;
+        int sniper_weight;
+        units_t health;
+        units_t ammo;
+        units_t range;
+        units_t power;
+        int num_of_matches;
+        int max_turns;
+        unsigned int seed;
+        int num_of_threads;
+        int num_of_copies;
+        int num_of_renders;
+        std::string script_path;
+
+        /**
+        * constructor of the config with the default parameters - a 64x64 board that is a quarter full with an even
+        * mix of the character types, and 16 random matches of up to 1000 turns on all the hardware threads.
+        */
+        SimulationConfig();
+    };
+
+    /**
+    * struct SimulationReport:
+    *      the measurements of a simulation run.
+    */
+    struct SimulationReport {
+        int num_of_matches;
+        int num_of_finished_matches;
+        long long num_of_turns;
+        long long num_of_actions;
+        long long num_of_attacks;
+        double seconds;
+        double actions_per_second;
+        double attacks_per_second;
+        double copy_microseconds;
+        double fork_microseconds;
+        double render_microseconds;
+    };
+
+    /**
+    * class Simulation:
+    *      a headless driver that measures the throughput of the game, as a reproducible baseline for performance
+    *      changes.
+    *      a run generates a random board from the seed of the config, and plays matches on forks of it with
+    *      MatchRunner. in a random match each team acts with a random unit in its turn - it attacks a random legal
+    *      target, or else moves to a random legal cell, or reloads when it is out of ammo or cannot move. in a
+    *      scripted match the actions of a script file are played in order, one action per turn.
+    *      the run then times copying, forking and printing the generated board.
+    *      a script file has an action in every line - "move r1 c1 r2 c2", "attack r1 c1 r2 c2" or "reload r c".
+    *      empty lines and lines starting with '#' are skipped.
+    */
+    class Simulation {
+    private:
+        static const int NUM_OF_TEAMS = 2;
+
+        /**
+        * struct ActionCounts:
+        *      the successful actions of a single match.
+        */
+        struct ActionCounts {
+            long long num_of_actions;
+            long long num_of_attacks;
+        };
+
+        class RandomActionPolicy;
+        class ScriptPolicy;
+
+        SimulationConfig config;
+        std::vector<Action> script;
+
+        /**
+        * timeBoardOperation: measures the average time of an operation over the generated board.
+        * @param num_of_repeats : the number of times to perform the operation.
+        * @param operation : the operation.
+        * @return the average time of the operation in microseconds, or 0 if num_of_repeats is 0.
+        */
+        template <class Operation>
+        static double timeBoardOperation(int num_of_repeats, const Operation& operation);
+        /**
+        * parseInt: parses a whole command line value as an int.
+        * @param text : the value.
+        * @param value : set to the parsed value.
+        * @return true if the value is a valid int.
+        */
+        static bool parseInt(const char* text, int& value);
+        /**
+        * parseOption: applies a single command line option to a config.
+        * @param name : the name of the option, including the leading "--".
+        * @param value : the value of the option.
+        * @param config : the config to update.
+        * @return true if the option is known and its value is valid.
+        */
+        static bool parseOption(const std::string& name, const char* value, SimulationConfig& config);
+
+    public:
+        /**
+        * constructor of the simulation that receives 1 parameter.
+        * @param config : the parameters of the simulation. the script file, if any, is loaded right away.
+        * possible errors:
+        *      - IllegalArgument : if a parameter is out of range - a non-positive board size, a density outside
+        *        [0, 1], negative or all-zero type weights, negative counts, or a script file that cannot be read
+        *        or has an invalid line.
+        */
+        explicit Simulation(const SimulationConfig& config);
+        /**
+        * generateBoard: generates the random board of the simulation. every cell holds a character with the
+        * probability of the density, of a type that is drawn by the type weights and of a random team.
+        * @return the board. the same config always generates the same board.
+        */
+        Game generateBoard() const;
+        /**
+        * run: plays the matches of the simulation and takes its measurements.
+        * @return the measurements.
+        */
+        SimulationReport run() const;
+        /**
+        * loadScript: reads the actions of a script file.
+        * @param path : the path of the file.
+        * @param actions : cleared and filled with the actions, in the order of the file.
+        * possible errors:
+        *      - IllegalArgument : if the file cannot be read or has an invalid line.
+        */
+        static void loadScript(const std::string& path, std::vector<Action>& actions);
+        /**
+        * printReport: prints the measurements of a run, a "name: value" pair in every line.
+        * @param os : the stream to print to.
+        * @param report : the measurements.
+        */
+        static void printReport(std::ostream& os, const SimulationReport& report);
+        /**
+        * printUsage: prints the command line options of runCli.
+        * @param os : the stream to print to.
+        */
+        static void printUsage(std::ostream& os);
+        /**
+        * runCli: runs a simulation that is configured by command line options, and prints its report.
+        * every option is a "--name value" pair that sets a field of SimulationConfig, as listed by printUsage, e.g.
+        * "--height 128 --density 0.5 --matches 100 --script actions.txt". the other fields keep their defaults.
+        * @param argc : the number of arguments, including the program name.
+        * @param argv : the arguments.
+        * @param os : the stream to print the report, or the usage and errors, to.
+        * @return 0 if the simulation ran, 1 if the options are invalid.
+        */
+        static int runCli(int argc, const char* const argv[], std::ostream& os);
+    };
+}
+
+#endif //GAME_PROJECT_SIMULATION_H
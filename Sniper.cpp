@@ -3,6 +3,7 @@
 //
 
 #include "Sniper.h"
+#include "PoolAllocator.h"
 
 namespace mtm
 {
@@ -20,11 +21,28 @@ namespace mtm
     Sniper::Sniper(units_t health_points, units_t ammo_points, units_t range, units_t power, mtm::Team team) :
             Character(health_points, ammo_points,range, power, team,
                       SNIPER_MOVEMENT_RANGE,SNIPER_RELOAD_AMMO_ADDITION,
-                      SNIPER_ATTACK_AMMO_COST, IDENTIFIER_CHAR_POWERLIFTERS, IDENTIFIER_CHAR_CROSSFITTERS),
+                      SNIPER_ATTACK_AMMO_COST, IDENTIFIER_CHAR_POWERLIFTERS, IDENTIFIER_CHAR_CROSSFITTERS,
+                      mtm::SNIPER),
             successful_strikes_counter(0) {}
 
     std::shared_ptr<Character>Sniper::clone() const {
-        return static_cast<std::shared_ptr<Character>>(new Sniper(*this));
+        return std::allocate_shared<Sniper>(PoolAllocator<Sniper>(), *this);
+    }
+
+    units_t Sniper::getCharacterStrikeAreaRadius() const {
+        return 0;
+    }
+
+    units_t Sniper::getCharacterMinimalStrikeRange() const {
+        return (getCharacterRange() + CEILING_FACTOR) / SNIPER_STRIKE_RANGE_FACTOR;
+    }
+
+    int Sniper::getSuccessfulStrikesCounter() const {
+        return successful_strikes_counter;
+    }
+
+    void Sniper::setSuccessfulStrikesCounter(int counter) {
+        successful_strikes_counter = counter;
     }
 
     bool Sniper::isTargetInStrikeRange(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates)
@@ -32,18 +50,18 @@ namespace mtm
         units_t character_strike_range = getCharacterRange();
         int distance_from_target = mtm::GridPoint::distance(src_coordinates, dst_coordinates);
         return ((distance_from_target <= character_strike_range) &&
-                (distance_from_target >= (character_strike_range + CEILING_FACTOR)/ SNIPER_STRIKE_RANGE_FACTOR));
+                (distance_from_target >= getCharacterMinimalStrikeRange()));
     }
 
     bool Sniper::isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
-                               std::shared_ptr<Character> target) const {
+                               const Character* target) const {
         return !(isTargetEmpty(target) || isTargetOnSameTeam(target));
     }
 
     units_t Sniper::performStrike(const mtm::GridPoint &src_coordinates,
                                   const mtm::GridPoint &main_target_coordinates,
                                   const mtm::GridPoint &current_target_coordinates,
-                                  std::shared_ptr<Character>target) {
+                                  const Character* target) {
         if (!(main_target_coordinates == current_target_coordinates))
         {
             return 0;
@@ -7,9 +7,11 @@ namespace mtm
     /**
     * class Sniper:
     *      represents the character of type Sniper.
+    *      the class is final, so calls through a Sniper reference are resolved at compile time.
     */
-    class Sniper : public Character{
+    class Sniper final : public Character{
     private:
+        friend class UnitStore;
 
         int successful_strikes_counter;
         static const units_t SNIPER_MOVEMENT_RANGE;
@@ -24,6 +26,8 @@ namespace mtm
         static const char IDENTIFIER_CHAR_CROSSFITTERS;
 
     public:
+        using Character::isStrikeLegal;
+        using Character::performStrike;
         /**
         * constructor to Sniper that receives 5 parameters.
         * @param health_points : represents the life of the Sniper - when it gets to 0 the Sniper is dead.
@@ -54,6 +58,27 @@ namespace mtm
         */
         std::shared_ptr<Character> clone() const override;
         /**
+        * getCharacterStrikeAreaRadius: returns the radius of the sniper strike around the main target.
+        * @return 0 - the sniper strikes only its main target.
+        */
+        units_t getCharacterStrikeAreaRadius() const override;
+        /**
+        * getCharacterMinimalStrikeRange: returns the minimal distance of a target from the Sniper.
+        * @return half of the Sniper range, rounded up.
+        */
+        units_t getCharacterMinimalStrikeRange() const;
+        /**
+        * getSuccessfulStrikesCounter: returns the number of strikes the Sniper has performed so far.
+        * @return the Sniper successful strikes counter.
+        */
+        int getSuccessfulStrikesCounter() const override;
+        /**
+        * setSuccessfulStrikesCounter: sets the number of strikes the Sniper has performed so far.
+        * used when a Sniper is restored from a stored state.
+        * @param counter : the new value of the successful strikes counter.
+        */
+        void setSuccessfulStrikesCounter(int counter) override;
+        /**
         * isTargetInStrikeRange: checks if the target is closer to the sniper from his maximum attack range but
         * further then his minimum attack range.
         * @param src_coordinates : the coordinates of the Sniper.
@@ -72,7 +97,7 @@ namespace mtm
         * @return true if the strike can be performed by the sniper.
         */
         bool isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
-                           std::shared_ptr<Character> target) const override;
+                           const Character* target) const override;
         /**
         * performStrike: performs the sniper strike. the sniper attacks only one time in one place.
         * if the target is an enemy the attack cost the normal sniper attack cost and he hits him according to his
@@ -85,7 +110,7 @@ namespace mtm
         * @return health points to reduce.
         */
         units_t performStrike(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& main_target_coordinates,
-                          const mtm::GridPoint& current_target_coordinates, std::shared_ptr<Character> target)
+                          const mtm::GridPoint& current_target_coordinates, const Character* target)
                           override;
     };
 }
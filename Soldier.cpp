@@ -1,4 +1,5 @@
 #include "Soldier.h"
+#include "PoolAllocator.h"
 
 namespace mtm
 {
@@ -14,11 +15,15 @@ namespace mtm
     Soldier::Soldier(units_t health_points, units_t ammo_points, units_t range, units_t power, mtm::Team team) :
             Character(health_points, ammo_points,range, power, team, SOLDIER_MOVEMENT_RANGE,
                       SOLDIER_RELOAD_AMMO_ADDITION, SOLDIER_ATTACK_AMMO_COST, IDENTIFIER_CHAR_POWERLIFTERS,
-                      IDENTIFIER_CHAR_CROSSFITTERS){
+                      IDENTIFIER_CHAR_CROSSFITTERS, mtm::SOLDIER){
     }
 
     std::shared_ptr<Character>Soldier::clone() const {
-        return static_cast<std::shared_ptr<Character>>(new Soldier(*this));
+        return std::allocate_shared<Soldier>(PoolAllocator<Soldier>(), *this);
+    }
+
+    units_t Soldier::getCharacterStrikeAreaRadius() const {
+        return ((getCharacterRange()+SOLDIER_SUB_STRIKE_RANGE-CEILING_FACTOR)/SOLDIER_SUB_STRIKE_RANGE);
     }
 
     bool Soldier::isTargetInStrikeRange(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates)
@@ -27,13 +32,13 @@ namespace mtm
     }
 
     bool Soldier::isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
-                                std::shared_ptr<Character> target) const {
+                                const Character* target) const {
         return ((src_coordinates.row == dst_coordinates.row) || (src_coordinates.col == dst_coordinates.col));
     }
 
     units_t Soldier::performCharacterMainStrike(const mtm::GridPoint& src_coordinates,
                                             const mtm::GridPoint& dst_coordinates,
-                                            const std::shared_ptr<Character>& target)  {
+                                            const Character* target)  {
         setCharacterAmmo(-getCharacterAttackAmmoCost());
         if (isTargetEmpty(target) || isTargetOnSameTeam(target))
         {
@@ -50,14 +55,12 @@ namespace mtm
         }
         int distance_between_targets = mtm::GridPoint::distance(main_target_coordinates,
                                                                 secondary_target_coordinates);
-        int soldier_strike_range = getCharacterRange();
-        return (distance_between_targets <=
-        ((soldier_strike_range+SOLDIER_SUB_STRIKE_RANGE-CEILING_FACTOR)/SOLDIER_SUB_STRIKE_RANGE));
+        return (distance_between_targets <= getCharacterStrikeAreaRadius());
     }
 
     int Soldier::performCharacterSecondaryStrike(const mtm::GridPoint& main_target_coordinates,
                                                  const mtm::GridPoint& secondary_target_coordinates,
-                                                 const std::shared_ptr<Character>& target) const {
+                                                 const Character* target) const {
         if (isTargetEmpty(target) || isTargetOnSameTeam(target))
         {
             return 0;
@@ -72,7 +75,7 @@ namespace mtm
     int Soldier::performStrike(const mtm::GridPoint &src_coordinates,
                                const mtm::GridPoint &main_target_coordinates,
                                const mtm::GridPoint &current_target_coordinates,
-                               std::shared_ptr<Character>target)
+                               const Character* target)
     {
         if (src_coordinates == current_target_coordinates)
         {
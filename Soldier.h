@@ -8,9 +8,11 @@
 /**
   * class Soldier:
   *      represents the character of type Soldier.
+  *      the class is final, so calls through a Soldier reference are resolved at compile time.
   */
-    class Soldier : public Character{
+    class Soldier final : public Character{
     private:
+        friend class UnitStore;
         static const units_t SOLDIER_MOVEMENT_RANGE;
         static const units_t SOLDIER_RELOAD_AMMO_ADDITION;
         static const units_t SOLDIER_ATTACK_AMMO_COST;
@@ -29,7 +31,7 @@
         */
         units_t performCharacterMainStrike(const mtm::GridPoint& src_coordinates,
                                            const mtm::GridPoint& dst_coordinates,
-                                           const std::shared_ptr<Character>& target);
+                                           const Character* target);
         /**
          * performCharacterSecondaryStrike : performs the soldier secondary strike.
          * @param main_target_coordinates : the coordinates of the soldier.
@@ -39,7 +41,7 @@
          */
         units_t performCharacterSecondaryStrike(const mtm::GridPoint& main_target_coordinates,
                                             const mtm::GridPoint& current_target_coordinates,
-                                            const std::shared_ptr<Character>& target) const;
+                                            const Character* target) const;
         /**
          * isTargetInSecondaryStrikeRange: checks if given coordinates are in the range of the secondary attack
          * coordinates.
@@ -52,6 +54,8 @@
                                             const mtm::GridPoint& secondary_target_coordinates) const;
 
     public:
+        using Character::isStrikeLegal;
+        using Character::performStrike;
         /**
         * constructor to Soldier that receives 5 parameters.
         * @param health_points : represents the life of the Soldier - when it gets to 0 the soldier is dead.
@@ -82,6 +86,11 @@
         */
         std::shared_ptr<Character> clone() const override;
         /**
+        * getCharacterStrikeAreaRadius: returns the radius of the Soldier secondary strike around the main target.
+        * @return the Soldier range divided by the secondary strike range factor, rounded up.
+        */
+        units_t getCharacterStrikeAreaRadius() const override;
+        /**
         * isTargetInStrikeRange: checks if the target is closer to the Soldier from his maximum attack range.
         * @param src_coordinates : the coordinates of the Soldier.
         * @param dst_coordinates : the target to attack.
@@ -98,7 +107,7 @@
         * @return true if the strike can be performed by the soldier.
         */
         bool isStrikeLegal(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& dst_coordinates,
-                           std::shared_ptr<Character> target) const override;
+                           const Character* target) const override;
         /**
         * performStrike: performs the soldier strike.
         * the soldier strike is divided into 2 parts, main strike and secondary strike.
@@ -115,7 +124,7 @@
         * @return health points to reduce.
         */
         units_t performStrike(const mtm::GridPoint& src_coordinates, const mtm::GridPoint& main_target_coordinates,
-                          const mtm::GridPoint& current_target_coordinates, std::shared_ptr<Character> target)
+                          const mtm::GridPoint& current_target_coordinates, const Character* target)
                           override;
     };
 }
@@ -0,0 +1,30 @@
+#ifndef GAME_PROJECT_TEAMPOLICY_H
+#define GAME_PROJECT_TEAMPOLICY_H
+#include "Game.h"
+
+namespace mtm
+{
+    /**
+    * class TeamPolicy:
+    *      decides and performs the actions of a team in a match.
+    *      a policy object is created for a single team of a single match, so it is only used by one thread at a time
+    *      and may keep its own state (random generators, caches) without locking.
+    */
+    class TeamPolicy {
+    public:
+        /**
+        * ~TeamPolicy: class destructor.
+        */
+        virtual ~TeamPolicy() = default;
+        /**
+        * playTurn: performs the actions of the team in its turn.
+        * failed actions are not errors - the policy is expected to use the non-throwing try methods of the game.
+        * @param game : the game of the match.
+        * @param team : the team whose turn it is.
+        * @param turn : the number of the turn in the match, starting from 0.
+        */
+        virtual void playTurn(Game& game, Team team, int turn) = 0;
+    };
+}
+
+#endif //GAME_PROJECT_TEAMPOLICY_H
@@ -0,0 +1,75 @@
+#include "TiledBoard.h"
+#include <atomic>
+
+namespace mtm
+{
+    using std::shared_ptr;
+
+    static const shared_ptr<Character> EMPTY_CELL = nullptr;
+
+    TiledBoard::TiledBoard(int height, int width) :
+            tiles_per_row((width >> TILE_SIDE_SHIFT) + ((width & (TILE_SIDE - 1)) == 0 ? 0 : 1)),
+            tiles(static_cast<size_t>((height >> TILE_SIDE_SHIFT) + ((height & (TILE_SIDE - 1)) == 0 ? 0 : 1)) *
+                  tiles_per_row, nullptr)
+    {}
+
+    int TiledBoard::getTileSide() {
+        return TILE_SIDE;
+    }
+
+    int TiledBoard::getTileIndex(const GridPoint& coordinates) const {
+        return (coordinates.row >> TILE_SIDE_SHIFT) * tiles_per_row + (coordinates.col >> TILE_SIDE_SHIFT);
+    }
+
+    int TiledBoard::getOffsetInTile(const GridPoint& coordinates) {
+        return ((coordinates.row & (TILE_SIDE - 1)) << TILE_SIDE_SHIFT) + (coordinates.col & (TILE_SIDE - 1));
+    }
+
+    void TiledBoard::makeTileWritable(int tile_index) {
+        shared_ptr<Tile>& tile = tiles[tile_index];
+        if (tile == nullptr)
+        {
+            tile = std::make_shared<Tile>();
+            return;
+        }
+        if (tile.use_count() == 1)
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return;
+        }
+        shared_ptr<Tile> private_tile = std::make_shared<Tile>();
+        for (int i = 0; i < TILE_CELLS; i++)
+        {
+            if (tile->cells[i] != nullptr)
+            {
+                private_tile->cells[i] = tile->cells[i]->clone();
+            }
+        }
+        tile = private_tile;
+    }
+
+    const shared_ptr<Character>& TiledBoard::getCell(const GridPoint& coordinates) const {
+        const shared_ptr<Tile>& tile = tiles[getTileIndex(coordinates)];
+        if (tile == nullptr)
+        {
+            return EMPTY_CELL;
+        }
+        return tile->cells[getOffsetInTile(coordinates)];
+    }
+
+    shared_ptr<Character>& TiledBoard::getWritableCell(const GridPoint& coordinates) {
+        int tile_index = getTileIndex(coordinates);
+        makeTileWritable(tile_index);
+        return tiles[tile_index]->cells[getOffsetInTile(coordinates)];
+    }
+
+    void TiledBoard::detachTiles() {
+        for (size_t i = 0; i < tiles.size(); i++)
+        {
+            if (tiles[i] != nullptr)
+            {
+                makeTileWritable(static_cast<int>(i));
+            }
+        }
+    }
+}
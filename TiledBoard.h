@@ -0,0 +1,90 @@
+#ifndef GAME_PROJECT_TILEDBOARD_H
+#define GAME_PROJECT_TILEDBOARD_H
+#include "Character.h"
+#include "Auxiliaries.h"
+#include <vector>
+#include <memory>
+
+namespace mtm
+{
+    /**
+    * class TiledBoard:
+    *      stores the cells of a game board in square tiles that are shared between copies of the board.
+    *      copying a board only copies the pointers to its tiles. a tile that is shared with another board is
+    *      copied, together with a clone of every character in it, the first time one of the boards writes to it.
+    *      tiles that were never written are not allocated at all, so sparse boards stay cheap.
+    *      cells of different tiles can be read and written from different threads at the same time.
+    */
+    class TiledBoard {
+    private:
+        static const int TILE_SIDE_SHIFT = 5;
+        static const int TILE_SIDE = 1 << TILE_SIDE_SHIFT;
+        static const int TILE_CELLS = TILE_SIDE * TILE_SIDE;
+
+        /**
+        * struct Tile:
+        *      TILE_SIDE x TILE_SIDE cells of the board in row-major order.
+        */
+        struct Tile {
+            std::shared_ptr<Character> cells[TILE_CELLS];
+        };
+
+        int tiles_per_row;
+        std::vector<std::shared_ptr<Tile>> tiles;
+
+        /**
+        * getTileIndex: returns the index of the tile that holds the given cell.
+        * @param coordinates : coordinates inside the board.
+        * @return index of the tile in the tiles array.
+        */
+        int getTileIndex(const GridPoint& coordinates) const;
+        /**
+        * getOffsetInTile: returns the index of the given cell inside its tile.
+        * @param coordinates : coordinates inside the board.
+        * @return index of the cell in the cells array of its tile.
+        */
+        static int getOffsetInTile(const GridPoint& coordinates);
+        /**
+        * makeTileWritable: makes sure the tile at the given index is allocated and is not shared with another
+        * board, copying the tile and cloning its characters if it is shared.
+        * use_count is a relaxed read, so a tile that is found unshared is written only after an acquire fence. the
+        * fence pairs with the release of the last other reference, so the reads of the board that dropped the tile,
+        * possibly on another thread, happen before the writes of this board.
+        * @param tile_index : index of the tile in the tiles array.
+        */
+        void makeTileWritable(int tile_index);
+
+    public:
+        /**
+        * constructor of the board that receives 2 parameters. all the cells start empty.
+        * @param height : number of rows in the board.
+        * @param width : number of columns in the board.
+        */
+        TiledBoard(int height, int width);
+        /**
+        * getTileSide: returns the number of rows and columns in a tile.
+        * @return the side of a tile.
+        */
+        static int getTileSide();
+        /**
+        * getCell: returns the character at the given coordinates for reading.
+        * @param coordinates : coordinates inside the board.
+        * @return the character at the cell, or null if the cell is empty.
+        */
+        const std::shared_ptr<Character>& getCell(const GridPoint& coordinates) const;
+        /**
+        * getWritableCell: returns the cell at the given coordinates for writing. if the tile of the cell is
+        * shared with another board it is copied first, so the returned character belongs only to this board.
+        * @param coordinates : coordinates inside the board.
+        * @return reference to the cell.
+        */
+        std::shared_ptr<Character>& getWritableCell(const GridPoint& coordinates);
+        /**
+        * detachTiles: copies every tile that is shared with another board, so the board no longer shares any
+        * character with other boards.
+        */
+        void detachTiles();
+    };
+}
+
+#endif //GAME_PROJECT_TILEDBOARD_H
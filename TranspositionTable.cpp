@@ -0,0 +1,70 @@
+#include "TranspositionTable.h"
+#include "Exceptions.h"
+
+namespace mtm
+{
+    const uint64_t TranspositionTable::EMPTY_SLOT_CHECK = ~static_cast<uint64_t>(0);
+
+    TranspositionTable::TranspositionTable(size_t num_of_slots) : index_mask(0), slots()
+    {
+        if (num_of_slots == 0)
+        {
+            throw IllegalArgument();
+        }
+        size_t size = 1;
+        while (size < num_of_slots)
+        {
+            size <<= 1;
+        }
+        index_mask = size - 1;
+        slots.reset(new Slot[size]);
+        clear();
+    }
+
+    uint64_t TranspositionTable::packEntry(const TranspositionEntry& entry) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(entry.depth)) << 32) |
+               static_cast<uint32_t>(entry.value);
+    }
+
+    TranspositionEntry TranspositionTable::unpackEntry(uint64_t data) {
+        TranspositionEntry entry = {static_cast<int32_t>(static_cast<uint32_t>(data)),
+                                    static_cast<int32_t>(static_cast<uint32_t>(data >> 32))};
+        return entry;
+    }
+
+    size_t TranspositionTable::getNumOfSlots() const {
+        return index_mask + 1;
+    }
+
+    bool TranspositionTable::probe(uint64_t hash, TranspositionEntry& entry) const {
+        const Slot& slot = slots[hash & index_mask];
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        uint64_t check = slot.check.load(std::memory_order_relaxed);
+        if ((check ^ data) != hash)
+        {
+            return false;
+        }
+        entry = unpackEntry(data);
+        return true;
+    }
+
+    void TranspositionTable::store(uint64_t hash, const TranspositionEntry& entry) {
+        Slot& slot = slots[hash & index_mask];
+        TranspositionEntry stored_entry;
+        if (probe(hash, stored_entry) && stored_entry.depth > entry.depth)
+        {
+            return;
+        }
+        uint64_t data = packEntry(entry);
+        slot.data.store(data, std::memory_order_relaxed);
+        slot.check.store(hash ^ data, std::memory_order_relaxed);
+    }
+
+    void TranspositionTable::clear() {
+        for (size_t i = 0; i <= index_mask; i++)
+        {
+            slots[i].data.store(0, std::memory_order_relaxed);
+            slots[i].check.store(EMPTY_SLOT_CHECK, std::memory_order_relaxed);
+        }
+    }
+}
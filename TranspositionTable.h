@@ -0,0 +1,95 @@
+#ifndef GAME_PROJECT_TRANSPOSITIONTABLE_H
+#define GAME_PROJECT_TRANSPOSITIONTABLE_H
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace mtm
+{
+    /**
+    * struct TranspositionEntry:
+    *      the cached result of searching a position - its value, and the depth it was searched to.
+    */
+    struct TranspositionEntry {
+        int32_t value;
+        int32_t depth;
+    };
+
+    /**
+    * class TranspositionTable:
+    *      a fixed size cache of search results keyed by the position hash of a game, that threads can probe and
+    *      store to at the same time without locks.
+    *      every slot keeps the entry and the xor of the entry with its hash in two atomic words. a slot that is
+    *      torn by stores of two threads does not pass the xor check, so a probe never returns an entry that was
+    *      not stored for its hash - it misses instead.
+    *      a store replaces the entry of its slot, unless the slot holds a deeper entry of the same hash.
+    */
+    class TranspositionTable {
+    private:
+        static const uint64_t EMPTY_SLOT_CHECK;
+
+        /**
+        * struct Slot:
+        *      a slot of the table. check holds the hash xor the data of the entry. an empty slot holds no data and
+        *      EMPTY_SLOT_CHECK, which only matches a hash that no position is expected to have.
+        */
+        struct Slot {
+            std::atomic<uint64_t> check;
+            std::atomic<uint64_t> data;
+        };
+
+        size_t index_mask;
+        std::unique_ptr<Slot[]> slots;
+
+        /**
+        * packEntry: packs an entry into a single word.
+        * @param entry : the entry.
+        * @return the packed entry.
+        */
+        static uint64_t packEntry(const TranspositionEntry& entry);
+        /**
+        * unpackEntry: unpacks an entry that was packed by packEntry.
+        * @param data : the packed entry.
+        * @return the entry.
+        */
+        static TranspositionEntry unpackEntry(uint64_t data);
+
+    public:
+        /**
+        * Constructor of the table that receives 1 parameter.
+        * @param num_of_slots : the minimal number of slots. rounded up to a power of 2.
+        * possible errors:
+        * IllegalArgument - if num_of_slots is not positive.
+        */
+        explicit TranspositionTable(size_t num_of_slots);
+        TranspositionTable(const TranspositionTable& other) = delete;
+        TranspositionTable& operator=(const TranspositionTable& other) = delete;
+        ~TranspositionTable() = default;
+
+        /**
+        * getNumOfSlots: returns the number of slots of the table.
+        * @return the number of slots.
+        */
+        size_t getNumOfSlots() const;
+        /**
+        * probe: looks up the entry of a position.
+        * @param hash : the position hash of the game.
+        * @param entry : set to the entry of the position if it is found.
+        * @return true if an entry of the position was found.
+        */
+        bool probe(uint64_t hash, TranspositionEntry& entry) const;
+        /**
+        * store: stores the entry of a position.
+        * @param hash : the position hash of the game.
+        * @param entry : the entry.
+        */
+        void store(uint64_t hash, const TranspositionEntry& entry);
+        /**
+        * clear: removes every entry of the table. must not run together with probes or stores.
+        */
+        void clear();
+    };
+}
+
+#endif //GAME_PROJECT_TRANSPOSITIONTABLE_H
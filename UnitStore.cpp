@@ -0,0 +1,239 @@
+#include "UnitStore.h"
+#include "Soldier.h"
+#include "Medic.h"
+#include "Sniper.h"
+#include "DamageKernel.h"
+#include "PoolAllocator.h"
+#include "Exceptions.h"
+#include <cstdlib>
+
+namespace mtm
+{
+    using std::vector;
+    using std::shared_ptr;
+
+    const UnitStore::TypeTraits UnitStore::TYPE_TRAITS[UnitStore::NUM_OF_TYPES] = {
+            {Soldier::SOLDIER_MOVEMENT_RANGE, Soldier::SOLDIER_RELOAD_AMMO_ADDITION, Soldier::SOLDIER_ATTACK_AMMO_COST,
+             Soldier::IDENTIFIER_CHAR_POWERLIFTERS, Soldier::IDENTIFIER_CHAR_CROSSFITTERS},
+            {Medic::MEDIC_MOVEMENT_RANGE, Medic::MEDIC_RELOAD_AMMO_ADDITION, Medic::MEDIC_ATTACK_AMMO_COST,
+             Medic::IDENTIFIER_CHAR_POWERLIFTERS, Medic::IDENTIFIER_CHAR_CROSSFITTERS},
+            {Sniper::SNIPER_MOVEMENT_RANGE, Sniper::SNIPER_RELOAD_AMMO_ADDITION, Sniper::SNIPER_ATTACK_AMMO_COST,
+             Sniper::IDENTIFIER_CHAR_POWERLIFTERS, Sniper::IDENTIFIER_CHAR_CROSSFITTERS}
+    };
+
+    const UnitStore::TypeTraits& UnitStore::getTypeTraits(CharacterType type) {
+        return TYPE_TRAITS[type];
+    }
+
+    int UnitStore::addUnit(const GridPoint& coordinates, CharacterType type, Team team, units_t health,
+                           units_t ammo, units_t range, units_t power, int successful_strikes_counter) {
+        rows.push_back(coordinates.row);
+        cols.push_back(coordinates.col);
+        health_points.push_back(health);
+        ammo_points.push_back(ammo);
+        ranges.push_back(range);
+        powers.push_back(power);
+        successful_strikes_counters.push_back(successful_strikes_counter);
+        teams.push_back(static_cast<uint8_t>(team));
+        types.push_back(static_cast<uint8_t>(type));
+        return getSize() - 1;
+    }
+
+    int UnitStore::addUnit(const GridPoint& coordinates, const Character& character) {
+        return addUnit(coordinates, character.getCharacterType(), character.getCharacterTeam(),
+                       character.getCharacterHealthPoints(), character.getCharacterAmmo(),
+                       character.getCharacterRange(), character.getCharacterPower(),
+                       character.getSuccessfulStrikesCounter());
+    }
+
+    void UnitStore::reserve(int num_of_units) {
+        rows.reserve(num_of_units);
+        cols.reserve(num_of_units);
+        health_points.reserve(num_of_units);
+        ammo_points.reserve(num_of_units);
+        ranges.reserve(num_of_units);
+        powers.reserve(num_of_units);
+        successful_strikes_counters.reserve(num_of_units);
+        teams.reserve(num_of_units);
+        types.reserve(num_of_units);
+    }
+
+    void UnitStore::clear() {
+        rows.clear();
+        cols.clear();
+        health_points.clear();
+        ammo_points.clear();
+        ranges.clear();
+        powers.clear();
+        successful_strikes_counters.clear();
+        teams.clear();
+        types.clear();
+    }
+
+    int UnitStore::getSize() const {
+        return static_cast<int>(health_points.size());
+    }
+
+    size_t UnitStore::getMemoryUsage() const {
+        return rows.capacity() * sizeof(int) + cols.capacity() * sizeof(int) +
+               health_points.capacity() * sizeof(units_t) + ammo_points.capacity() * sizeof(units_t) +
+               ranges.capacity() * sizeof(units_t) + powers.capacity() * sizeof(units_t) +
+               successful_strikes_counters.capacity() * sizeof(int) + teams.capacity() * sizeof(uint8_t) +
+               types.capacity() * sizeof(uint8_t);
+    }
+
+    GridPoint UnitStore::getUnitCoordinates(int unit_id) const {
+        return GridPoint(rows[unit_id], cols[unit_id]);
+    }
+
+    UnitView UnitStore::getUnit(int unit_id) {
+        return UnitView(this, unit_id);
+    }
+
+    int UnitStore::countAliveUnits(Team team) const {
+        int alive_units = 0;
+        const units_t* health = health_points.data();
+        const uint8_t* team_of_unit = teams.data();
+        int size = getSize();
+        for (int i = 0; i < size; i++)
+        {
+            alive_units += static_cast<int>((health[i] > 0) & (team_of_unit[i] == team));
+        }
+        return alive_units;
+    }
+
+    void UnitStore::computeAreaDamage(const GridPoint& center, int radius, Team attacker_team, units_t damage,
+                                      vector<units_t>& damage_field) const {
+        int size = getSize();
+        damage_field.resize(size);
+        const int* unit_rows = rows.data();
+        const int* unit_cols = cols.data();
+        const uint8_t* team_of_unit = teams.data();
+        units_t* field = damage_field.data();
+        for (int i = 0; i < size; i++)
+        {
+            int distance = std::abs(unit_rows[i] - center.row) + std::abs(unit_cols[i] - center.col);
+            bool is_hit = (distance <= radius) & (team_of_unit[i] != attacker_team);
+            field[i] = damage & -static_cast<units_t>(is_hit);
+        }
+    }
+
+    int UnitStore::applyDamageField(const vector<units_t>& damage_field) {
+        if (static_cast<int>(damage_field.size()) != getSize())
+        {
+            throw IllegalArgument();
+        }
+        return DamageKernel::applyDamageField(health_points.data(), damage_field.data(), getSize());
+    }
+
+    int UnitStore::removeDeadUnits() {
+        int size = getSize();
+        int num_of_alive = 0;
+        for (int i = 0; i < size; i++)
+        {
+            if (health_points[i] <= 0)
+            {
+                continue;
+            }
+            rows[num_of_alive] = rows[i];
+            cols[num_of_alive] = cols[i];
+            health_points[num_of_alive] = health_points[i];
+            ammo_points[num_of_alive] = ammo_points[i];
+            ranges[num_of_alive] = ranges[i];
+            powers[num_of_alive] = powers[i];
+            successful_strikes_counters[num_of_alive] = successful_strikes_counters[i];
+            teams[num_of_alive] = teams[i];
+            types[num_of_alive] = types[i];
+            num_of_alive++;
+        }
+        rows.resize(num_of_alive);
+        cols.resize(num_of_alive);
+        health_points.resize(num_of_alive);
+        ammo_points.resize(num_of_alive);
+        ranges.resize(num_of_alive);
+        powers.resize(num_of_alive);
+        successful_strikes_counters.resize(num_of_alive);
+        teams.resize(num_of_alive);
+        types.resize(num_of_alive);
+        return size - num_of_alive;
+    }
+
+    shared_ptr<Character> UnitStore::makeCharacter(int unit_id) const {
+        Team team = static_cast<Team>(teams[unit_id]);
+        switch (static_cast<CharacterType>(types[unit_id])) {
+            case SOLDIER :
+                return std::allocate_shared<Soldier>(PoolAllocator<Soldier>(), health_points[unit_id],
+                                                     ammo_points[unit_id], ranges[unit_id], powers[unit_id], team);
+            case MEDIC :
+                return std::allocate_shared<Medic>(PoolAllocator<Medic>(), health_points[unit_id],
+                                                   ammo_points[unit_id], ranges[unit_id], powers[unit_id], team);
+            case SNIPER :
+            default :
+                shared_ptr<Sniper> sniper = std::allocate_shared<Sniper>(PoolAllocator<Sniper>(),
+                                                                         health_points[unit_id], ammo_points[unit_id],
+                                                                         ranges[unit_id], powers[unit_id], team);
+                sniper->setSuccessfulStrikesCounter(successful_strikes_counters[unit_id]);
+                return sniper;
+        }
+    }
+
+    UnitView::UnitView(UnitStore* store, int unit_id) : store(store), unit_id(unit_id)
+    {}
+
+    int UnitView::getUnitId() const {
+        return unit_id;
+    }
+
+    Team UnitView::getCharacterTeam() const {
+        return static_cast<Team>(store->teams[unit_id]);
+    }
+
+    CharacterType UnitView::getCharacterType() const {
+        return static_cast<CharacterType>(store->types[unit_id]);
+    }
+
+    units_t UnitView::getCharacterHealthPoints() const {
+        return store->health_points[unit_id];
+    }
+
+    units_t UnitView::getCharacterAmmo() const {
+        return store->ammo_points[unit_id];
+    }
+
+    units_t UnitView::getCharacterRange() const {
+        return store->ranges[unit_id];
+    }
+
+    units_t UnitView::getCharacterPower() const {
+        return store->powers[unit_id];
+    }
+
+    units_t UnitView::getCharacterMovementRange() const {
+        return UnitStore::getTypeTraits(getCharacterType()).movement_range;
+    }
+
+    units_t UnitView::getCharacterReloadAmmoAddition() const {
+        return UnitStore::getTypeTraits(getCharacterType()).reload_ammo_addition;
+    }
+
+    char UnitView::getCharacterIdentifierChar() const {
+        const UnitStore::TypeTraits& traits = UnitStore::getTypeTraits(getCharacterType());
+        if (getCharacterTeam() == POWERLIFTERS)
+        {
+            return traits.identifier_char_powerlifters;
+        }
+        return traits.identifier_char_crossfitters;
+    }
+
+    bool UnitView::isCharacterAlive() const {
+        return (getCharacterHealthPoints() > 0);
+    }
+
+    void UnitView::setCharacterHealthPoints(units_t points) {
+        store->health_points[unit_id] += points;
+    }
+
+    void UnitView::setCharacterAmmo(units_t ammo) {
+        store->ammo_points[unit_id] += ammo;
+    }
+}
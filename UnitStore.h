@@ -0,0 +1,235 @@
+#ifndef GAME_PROJECT_UNITSTORE_H
+#define GAME_PROJECT_UNITSTORE_H
+#include "Character.h"
+#include "Auxiliaries.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace mtm
+{
+    class UnitView;
+
+    /**
+    * class UnitStore:
+    *      a compact store of units in structure-of-arrays layout.
+    *      every field of the units is kept in its own array indexed by the unit id, so scans over a single field
+    *      touch only that field and can be vectorized. the constants that are shared by all the units of a type
+    *      (movement range, reload ammo addition, attack ammo cost and identifier chars) are not stored per unit,
+    *      they are looked up in a static table by the unit type.
+    *      unit ids are the indices 0 to getSize()-1 in the order the units were added.
+    */
+    class UnitStore {
+    public:
+        /**
+        * struct TypeTraits:
+        *      the constants of a character type.
+        */
+        struct TypeTraits {
+            units_t movement_range;
+            units_t reload_ammo_addition;
+            units_t attack_ammo_cost;
+            char identifier_char_powerlifters;
+            char identifier_char_crossfitters;
+        };
+
+    private:
+        static const int NUM_OF_TYPES = 3;
+        static const TypeTraits TYPE_TRAITS[NUM_OF_TYPES];
+        std::vector<int> rows;
+        std::vector<int> cols;
+        std::vector<units_t> health_points;
+        std::vector<units_t> ammo_points;
+        std::vector<units_t> ranges;
+        std::vector<units_t> powers;
+        std::vector<int> successful_strikes_counters;
+        std::vector<uint8_t> teams;
+        std::vector<uint8_t> types;
+
+        friend class UnitView;
+
+    public:
+        /**
+        * getTypeTraits: returns the constants of a character type.
+        * @param type : the type of the character.
+        * @return the constants of the type.
+        */
+        static const TypeTraits& getTypeTraits(CharacterType type);
+        /**
+        * addUnit: adds a unit to the store.
+        * @param coordinates : the coordinates of the unit on the board.
+        * @param type : the type of the unit.
+        * @param team : the team of the unit.
+        * @param health : the health points of the unit.
+        * @param ammo : the ammo points of the unit.
+        * @param range : the range of the unit.
+        * @param power : the power of the unit.
+        * @param successful_strikes_counter : the number of strikes the unit performed - used only by snipers.
+        * @return the id of the new unit.
+        */
+        int addUnit(const GridPoint& coordinates, CharacterType type, Team team, units_t health, units_t ammo,
+                    units_t range, units_t power, int successful_strikes_counter = 0);
+        /**
+        * addUnit: adds a copy of the state of a character to the store.
+        * @param coordinates : the coordinates of the character on the board.
+        * @param character : the character to copy.
+        * @return the id of the new unit.
+        */
+        int addUnit(const GridPoint& coordinates, const Character& character);
+        /**
+        * reserve: allocates room for a given number of units in advance.
+        * @param num_of_units : the number of units to allocate room for.
+        */
+        void reserve(int num_of_units);
+        /**
+        * clear: removes all the units from the store.
+        */
+        void clear();
+        /**
+        * getSize: returns the number of units in the store.
+        * @return the number of units.
+        */
+        int getSize() const;
+        /**
+        * getMemoryUsage: returns the number of bytes allocated by the arrays of the store. a unit takes the size of
+        * its fields, with no per-unit object, pointer or reference count.
+        * @return the number of bytes.
+        */
+        size_t getMemoryUsage() const;
+        /**
+        * getUnitCoordinates: returns the coordinates of a unit on the board.
+        * @param unit_id : id of the unit.
+        * @return the coordinates of the unit.
+        */
+        GridPoint getUnitCoordinates(int unit_id) const;
+        /**
+        * getUnit: returns a view of a unit that can be used like a character.
+        * @param unit_id : id of the unit.
+        * @return view of the unit.
+        */
+        UnitView getUnit(int unit_id);
+        /**
+        * countAliveUnits: counts the units of a team that have positive health points.
+        * @param team : the team to count.
+        * @return the number of alive units of the team.
+        */
+        int countAliveUnits(Team team) const;
+        /**
+        * computeAreaDamage: builds the damage field of an area effect - the given damage for every unit of the
+        * other team whose distance from the center is at most the radius, and 0 for every other unit.
+        * @param center : the center of the area.
+        * @param radius : the radius of the area.
+        * @param attacker_team : the team of the attacker. its units are not damaged.
+        * @param damage : the damage of the units inside the area.
+        * @param damage_field : resized to the number of units and filled with the damage of every unit.
+        */
+        void computeAreaDamage(const GridPoint& center, int radius, Team attacker_team, units_t damage,
+                               std::vector<units_t>& damage_field) const;
+        /**
+        * applyDamageField: subtracts the damage of every unit from its health points in one vectorized pass.
+        * @param damage_field : the damage of every unit, indexed by the unit id.
+        * @return the number of units that were alive before the pass and are not alive after it.
+        * possible errors:
+        *      - IllegalArgument : if the size of the damage field is not the number of units.
+        */
+        int applyDamageField(const std::vector<units_t>& damage_field);
+        /**
+        * removeDeadUnits: removes the units that are not alive from the store, keeping the order of the others.
+        * the ids of the remaining units change to their new positions.
+        * @return the number of removed units.
+        */
+        int removeDeadUnits();
+        /**
+        * makeCharacter: creates a character with the state of a unit.
+        * @param unit_id : id of the unit.
+        * @return shared ptr to a new character that is independent from the store.
+        */
+        std::shared_ptr<Character> makeCharacter(int unit_id) const;
+    };
+
+    /**
+    * class UnitView:
+    *      a reference to a unit in a UnitStore that offers the same accessors as the Character class.
+    *      the view is valid as long as the store is not cleared.
+    */
+    class UnitView {
+    private:
+        UnitStore* store;
+        int unit_id;
+
+    public:
+        /**
+        * constructor of the view that receives 2 parameters.
+        * @param store : the store that holds the unit.
+        * @param unit_id : id of the unit.
+        */
+        UnitView(UnitStore* store, int unit_id);
+        /**
+        * getUnitId: returns the id of the unit in the store.
+        * @return id of the unit.
+        */
+        int getUnitId() const;
+        /**
+        * getCharacterTeam : returns the team of the unit.
+        * @return the team of the unit.
+        */
+        Team getCharacterTeam() const;
+        /**
+        * getCharacterType : returns the type of the unit.
+        * @return the type of the unit.
+        */
+        CharacterType getCharacterType() const;
+        /**
+        * getCharacterHealthPoints: returns the health points of the unit.
+        * @return the health points of the unit.
+        */
+        units_t getCharacterHealthPoints() const;
+        /**
+        * getCharacterAmmo: returns the ammo points of the unit.
+        * @return the ammo points of the unit.
+        */
+        units_t getCharacterAmmo() const;
+        /**
+        * getCharacterRange: returns the range of the unit.
+        * @return the range of the unit.
+        */
+        units_t getCharacterRange() const;
+        /**
+        * getCharacterPower: returns the power of the unit.
+        * @return the power of the unit.
+        */
+        units_t getCharacterPower() const;
+        /**
+        * getCharacterMovementRange: returns the maximal movement range of the unit's type.
+        * @return the movement range of the unit.
+        */
+        units_t getCharacterMovementRange() const;
+        /**
+        * getCharacterReloadAmmoAddition: returns the ammo added to the unit in a reloading action.
+        * @return the reload ammo addition of the unit.
+        */
+        units_t getCharacterReloadAmmoAddition() const;
+        /**
+        * getCharacterIdentifierChar: returns the char that symbolizes the unit according to its type and team.
+        * @return the identifier char of the unit.
+        */
+        char getCharacterIdentifierChar() const;
+        /**
+        * isCharacterAlive: checks if the unit has positive health points.
+        * @return true if the unit is alive.
+        */
+        bool isCharacterAlive() const;
+        /**
+        * setCharacterHealthPoints: adds the given points to the health points of the unit.
+        * @param points : the points to add, negative to reduce.
+        */
+        void setCharacterHealthPoints(units_t points);
+        /**
+        * setCharacterAmmo: adds the given ammo to the ammo points of the unit.
+        * @param ammo : the ammo to add, negative to reduce.
+        */
+        void setCharacterAmmo(units_t ammo);
+    };
+}
+
+#endif //GAME_PROJECT_UNITSTORE_H
@@ -0,0 +1,80 @@
+#include "UnitTracker.h"
+
+namespace mtm
+{
+    using std::vector;
+
+    UnitTracker::UnitTracker() :
+            is_synced(false), synced_version(0), team_units(), unit_slots(), updates(), units()
+    {}
+
+    int64_t UnitTracker::getCellKey(const GridPoint& coordinates) {
+        return (static_cast<int64_t>(coordinates.row) << 32) | static_cast<uint32_t>(coordinates.col);
+    }
+
+    void UnitTracker::addUnit(const GridPoint& coordinates, Team team) {
+        UnitSlot slot = {team, static_cast<int>(team_units[team].size())};
+        team_units[team].push_back(coordinates);
+        unit_slots[getCellKey(coordinates)] = slot;
+    }
+
+    void UnitTracker::removeUnit(const GridPoint& coordinates) {
+        std::unordered_map<int64_t, UnitSlot>::iterator removed = unit_slots.find(getCellKey(coordinates));
+        if (removed == unit_slots.end())
+        {
+            return;
+        }
+        UnitSlot slot = removed->second;
+        unit_slots.erase(removed);
+        vector<GridPoint>& units_of_team = team_units[slot.team];
+        if (slot.index != static_cast<int>(units_of_team.size()) - 1)
+        {
+            units_of_team[slot.index] = units_of_team.back();
+            unit_slots[getCellKey(units_of_team[slot.index])].index = slot.index;
+        }
+        units_of_team.pop_back();
+    }
+
+    void UnitTracker::exportAll(const Game& game) {
+        for (vector<GridPoint>& units_of_team : team_units)
+        {
+            units_of_team.clear();
+        }
+        unit_slots.clear();
+        units.clear();
+        game.exportUnits(units);
+        for (int unit_id = 0; unit_id < units.getSize(); unit_id++)
+        {
+            addUnit(units.getUnitCoordinates(unit_id), units.getUnit(unit_id).getCharacterTeam());
+        }
+    }
+
+    void UnitTracker::update(const Game& game) {
+        if (!is_synced || !game.getBoardChanges(synced_version, updates))
+        {
+            exportAll(game);
+        }
+        else
+        {
+            for (const CellUpdate& update : updates)
+            {
+                removeUnit(update.coordinates);
+                const Character* character = game.getCharacter(update.coordinates);
+                if (character != nullptr)
+                {
+                    addUnit(update.coordinates, character->getCharacterTeam());
+                }
+            }
+        }
+        is_synced = true;
+        synced_version = game.getBoardVersion();
+    }
+
+    void UnitTracker::reset() {
+        is_synced = false;
+    }
+
+    const vector<GridPoint>& UnitTracker::getUnits(Team team) const {
+        return team_units[team];
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef GAME_PROJECT_UNITTRACKER_H
+#define GAME_PROJECT_UNITTRACKER_H
+#include "Game.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace mtm
+{
+    /**
+    * class UnitTracker:
+    *      keeps the coordinates of the units of each team of a game, for policies that pick units every turn.
+    *      the lists are updated from the changes of the board since the last update (getBoardChanges), so an update
+    *      costs the number of changed cells, and the whole board is only exported when the changes are not known -
+    *      on the first update, after a copy or an assignment of the game, or after the change log was trimmed.
+    *      the order of the units in a list depends only on the updates, so random choices over the lists are
+    *      reproducible.
+    */
+    class UnitTracker {
+    private:
+        static const int NUM_OF_TEAMS = 2;
+
+        /**
+        * struct UnitSlot:
+        *      the position of a unit in the lists.
+        */
+        struct UnitSlot {
+            Team team;
+            int index;
+        };
+
+        bool is_synced;
+        unsigned long long synced_version;
+        std::vector<GridPoint> team_units[NUM_OF_TEAMS];
+        std::unordered_map<int64_t, UnitSlot> unit_slots;
+        std::vector<CellUpdate> updates;
+        UnitStore units;
+
+        /**
+        * getCellKey: returns the key of a cell in unit_slots.
+        * @param coordinates : the coordinates of the cell.
+        * @return the key of the cell.
+        */
+        static int64_t getCellKey(const GridPoint& coordinates);
+        /**
+        * addUnit: adds the unit at a cell to the list of its team.
+        * @param coordinates : the coordinates of the unit.
+        * @param team : the team of the unit.
+        */
+        void addUnit(const GridPoint& coordinates, Team team);
+        /**
+        * removeUnit: removes the unit at a cell from the list of its team, if the cell has a unit in the lists.
+        * the last unit of the list takes its place.
+        * @param coordinates : the coordinates of the cell.
+        */
+        void removeUnit(const GridPoint& coordinates);
+        /**
+        * exportAll: rebuilds the lists from all the characters of a game.
+        * @param game : the game.
+        */
+        void exportAll(const Game& game);
+
+    public:
+        /**
+        * constructor of an empty tracker, that is synced on its first update.
+        */
+        UnitTracker();
+        /**
+        * update: brings the lists up to date with a game.
+        * a tracker follows a single game - reset it before updating it from another game, including a game that
+        * was created at the same address as the previous one.
+        * @param game : the game.
+        */
+        void update(const Game& game);
+        /**
+        * reset: forgets the lists, so the next update exports the whole board.
+        */
+        void reset();
+        /**
+        * getUnits: returns the coordinates of the units of a team, as of the last update.
+        * @param team : the team.
+        * @return the coordinates of the units of the team.
+        */
+        const std::vector<GridPoint>& getUnits(Team team) const;
+    };
+}
+
+#endif //GAME_PROJECT_UNITTRACKER_H
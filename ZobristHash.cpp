@@ -0,0 +1,25 @@
+#include "ZobristHash.h"
+
+namespace mtm
+{
+    const uint64_t ZobristHash::SEED = 0x243f6a8885a308d3ULL;
+    const uint64_t ZobristHash::GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+    uint64_t ZobristHash::mix(uint64_t key, uint64_t field) {
+        uint64_t z = key ^ (field + GOLDEN_GAMMA);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t ZobristHash::getCharacterKey(const GridPoint& coordinates, const Character& character) {
+        uint64_t key = mix(SEED, (static_cast<uint64_t>(static_cast<uint32_t>(coordinates.row)) << 32) |
+                                 static_cast<uint32_t>(coordinates.col));
+        key = mix(key, (static_cast<uint64_t>(character.getCharacterType()) << 8) | character.getCharacterTeam());
+        key = mix(key, (static_cast<uint64_t>(static_cast<uint32_t>(character.getCharacterHealthPoints())) << 32) |
+                       static_cast<uint32_t>(character.getCharacterAmmo()));
+        key = mix(key, (static_cast<uint64_t>(static_cast<uint32_t>(character.getCharacterRange())) << 32) |
+                       static_cast<uint32_t>(character.getCharacterPower()));
+        return mix(key, static_cast<uint32_t>(character.getSuccessfulStrikesCounter()));
+    }
+}
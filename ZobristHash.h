@@ -0,0 +1,42 @@
+#ifndef GAME_PROJECT_ZOBRISTHASH_H
+#define GAME_PROJECT_ZOBRISTHASH_H
+#include "Character.h"
+#include "Auxiliaries.h"
+#include <cstdint>
+
+namespace mtm
+{
+    /**
+    * class ZobristHash:
+    *      the keys of the zobrist hash of a game position. the hash of a position is the xor of the keys of its
+    *      characters, so an action updates it by xoring out the keys of the cells it modifies before the action
+    *      and xoring in their keys after it.
+    *      since the board size and the stats of the characters are not bounded, the keys are not drawn into tables
+    *      but computed by mixing the state of the character with its cell, which gives the same key every time.
+    */
+    class ZobristHash {
+    private:
+        static const uint64_t SEED;
+        static const uint64_t GOLDEN_GAMMA;
+
+        /**
+        * mix: combines a key with another field of the character and scrambles the result.
+        * @param key : the key so far.
+        * @param field : the field to combine.
+        * @return the new key.
+        */
+        static uint64_t mix(uint64_t key, uint64_t field);
+
+    public:
+        /**
+        * getCharacterKey: returns the key of a character standing at a given cell.
+        * the key depends on the cell, type, team, health, ammo, range, power and strikes counter of the character.
+        * @param coordinates : the coordinates of the cell.
+        * @param character : the character.
+        * @return the key of the character.
+        */
+        static uint64_t getCharacterKey(const GridPoint& coordinates, const Character& character);
+    };
+}
+
+#endif //GAME_PROJECT_ZOBRISTHASH_H
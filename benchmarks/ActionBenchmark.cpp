@@ -0,0 +1,127 @@
+#include "Game.h"
+#include "Exceptions.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * a board where every action of getRejectedActions is rejected - a move that is too far, an attack that is
+    * out of range and an attack without ammo.
+    */
+    Game makeRejectingBoard() {
+        Game game(16, 16);
+        game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+        game.addCharacter(GridPoint(1, 1), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 0, 5, 1));
+        game.addCharacter(GridPoint(1, 3), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 2, 1));
+        game.addCharacter(GridPoint(10, 10), Game::makeCharacter(SNIPER, CROSSFITTERS, 10, 5, 2, 1));
+        return game;
+    }
+
+    std::vector<Action> getRejectedActions() {
+        std::vector<Action> actions;
+        actions.push_back(Action(MOVE_ACTION, GridPoint(0, 0), GridPoint(15, 0)));
+        actions.push_back(Action(ATTACK_ACTION, GridPoint(0, 0), GridPoint(10, 10)));
+        actions.push_back(Action(ATTACK_ACTION, GridPoint(1, 1), GridPoint(1, 3)));
+        return actions;
+    }
+
+    void BM_RejectedTryAction(benchmark::State& state) {
+        Game game = makeRejectingBoard();
+        std::vector<Action> actions = getRejectedActions();
+        size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(game.tryAction(actions[i]));
+            i = (i + 1) % actions.size();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_RejectedThrowingAction(benchmark::State& state) {
+        Game game = makeRejectingBoard();
+        std::vector<Action> actions = getRejectedActions();
+        size_t i = 0;
+        for (auto _ : state)
+        {
+            const Action& action = actions[i];
+            try
+            {
+                if (action.type == MOVE_ACTION)
+                {
+                    game.move(action.src_coordinates, action.dst_coordinates);
+                }
+                else
+                {
+                    game.attack(action.src_coordinates, action.dst_coordinates);
+                }
+            }
+            catch (const mtm::Exception& e)
+            {
+                benchmark::DoNotOptimize(e.what());
+            }
+            i = (i + 1) % actions.size();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+    * a turn of reloads and back and forth moves of every unit of a 16x16 board, with undo enabled and the turn
+    * undone after every iteration, so every iteration starts from the same board.
+    */
+    std::vector<Action> getTurnActions() {
+        std::vector<Action> actions;
+        for (int r = 0; r < 16; r += 2)
+        {
+            actions.push_back(Action(RELOAD_ACTION, GridPoint(r, 0), GridPoint(r, 0)));
+            actions.push_back(Action(MOVE_ACTION, GridPoint(r, 0), GridPoint(r, 1)));
+            actions.push_back(Action(MOVE_ACTION, GridPoint(r, 1), GridPoint(r, 0)));
+        }
+        return actions;
+    }
+
+    Game makeTurnBoard() {
+        Game game(16, 16);
+        for (int r = 0; r < 16; r += 2)
+        {
+            game.addCharacter(GridPoint(r, 0), Game::makeCharacter(SOLDIER, static_cast<Team>(r / 2 % 2), 10, 5, 2, 1));
+        }
+        game.setUndoEnabled(true);
+        return game;
+    }
+
+    void BM_TurnWithTryAction(benchmark::State& state) {
+        Game game = makeTurnBoard();
+        std::vector<Action> actions = getTurnActions();
+        for (auto _ : state)
+        {
+            for (const Action& action : actions)
+            {
+                benchmark::DoNotOptimize(game.tryAction(action));
+            }
+            while (game.undo())
+            {
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * actions.size());
+    }
+
+    void BM_TurnWithApplyBatch(benchmark::State& state) {
+        Game game = makeTurnBoard();
+        std::vector<Action> actions = getTurnActions();
+        std::vector<ActionStatus> results;
+        for (auto _ : state)
+        {
+            game.applyBatch(actions, results);
+            game.undo();
+        }
+        state.SetItemsProcessed(state.iterations() * actions.size());
+    }
+}
+
+BENCHMARK(BM_RejectedTryAction);
+BENCHMARK(BM_RejectedThrowingAction);
+BENCHMARK(BM_TurnWithTryAction);
+BENCHMARK(BM_TurnWithApplyBatch);
@@ -0,0 +1,78 @@
+#include "ActionJournal.h"
+#include "RandomPolicy.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+
+using namespace mtm;
+
+namespace
+{
+    const int NUM_OF_TURNS = 20000;
+
+    /**
+    * records the journal of a random match on a 64x64 board that is a quarter full. the journal has no checkpoints
+    * but the first one, so a replay performs every action.
+    */
+    std::unique_ptr<ActionJournal> recordMatch(Game& game) {
+        std::mt19937 generator(1);
+        for (int r = 0; r < 64; r++)
+        {
+            for (int c = 0; c < 64; c++)
+            {
+                if (generator() % 4 == 0)
+                {
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(
+                            static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                            10, 3, 4, 2));
+                }
+            }
+        }
+        std::unique_ptr<ActionJournal> journal(new ActionJournal(game, 0));
+        game.setJournal(journal.get());
+        RandomPolicy policies[] = {RandomPolicy(1), RandomPolicy(2)};
+        for (int turn = 0; turn < NUM_OF_TURNS && !game.isOver(); turn++)
+        {
+            policies[turn % 2].playTurn(game, static_cast<Team>(turn % 2), turn);
+        }
+        game.setJournal(nullptr);
+        return journal;
+    }
+
+    void reportActions(benchmark::State& state, const ActionJournal& journal) {
+        state.counters["actions/s"] = benchmark::Counter(
+                static_cast<double>(journal.getNumOfActions()) * state.iterations(), benchmark::Counter::kIsRate);
+    }
+
+    /**
+    * replays the journal that recorded the match, without checking the actions.
+    */
+    void BM_TrustedReplay(benchmark::State& state) {
+        Game game(64, 64);
+        std::unique_ptr<ActionJournal> journal = recordMatch(game);
+        for (auto _ : state)
+        {
+            Game replayed = journal->replay();
+            benchmark::DoNotOptimize(replayed);
+        }
+        reportActions(state, *journal);
+    }
+
+    /**
+    * replays the same journal after loading it from its data, checking every action against the replayed game.
+    */
+    void BM_LoadedReplay(benchmark::State& state) {
+        Game game(64, 64);
+        std::unique_ptr<ActionJournal> journal = recordMatch(game);
+        ActionJournal loaded(journal->getData().data(), journal->getData().size());
+        for (auto _ : state)
+        {
+            Game replayed = loaded.replay();
+            benchmark::DoNotOptimize(replayed);
+        }
+        reportActions(state, loaded);
+    }
+}
+
+BENCHMARK(BM_TrustedReplay)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadedReplay)->Unit(benchmark::kMillisecond);
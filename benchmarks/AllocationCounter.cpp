@@ -0,0 +1,44 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<unsigned long long> num_of_allocations(0);
+    std::atomic<unsigned long long> num_of_allocated_bytes(0);
+}
+
+void* operator new(std::size_t size) {
+    num_of_allocations.fetch_add(1, std::memory_order_relaxed);
+    num_of_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    void* block = std::malloc(size == 0 ? 1 : size);
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+void operator delete[](void* block) noexcept {
+    std::free(block);
+}
+
+namespace mtm
+{
+    unsigned long long AllocationCounter::getAllocations() {
+        return num_of_allocations.load(std::memory_order_relaxed);
+    }
+
+    unsigned long long AllocationCounter::getAllocatedBytes() {
+        return num_of_allocated_bytes.load(std::memory_order_relaxed);
+    }
+}
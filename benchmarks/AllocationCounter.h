@@ -0,0 +1,27 @@
+#ifndef GAME_PROJECT_ALLOCATIONCOUNTER_H
+#define GAME_PROJECT_ALLOCATIONCOUNTER_H
+#include <cstddef>
+
+namespace mtm
+{
+    /**
+    * class AllocationCounter:
+    *      counts the calls to the global operator new of the benchmark program and the bytes they asked for.
+    *      the counters only grow, so the allocations of a piece of code are the difference of two readings.
+    */
+    class AllocationCounter {
+    public:
+        /**
+        * getAllocations: returns the number of calls to operator new so far.
+        * @return the number of allocations.
+        */
+        static unsigned long long getAllocations();
+        /**
+        * getAllocatedBytes: returns the total size asked from operator new so far.
+        * @return the number of bytes.
+        */
+        static unsigned long long getAllocatedBytes();
+    };
+}
+
+#endif //GAME_PROJECT_ALLOCATIONCOUNTER_H
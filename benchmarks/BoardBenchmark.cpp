@@ -0,0 +1,225 @@
+#include "Game.h"
+#include "AllocationCounter.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <streambuf>
+
+using namespace mtm;
+
+namespace
+{
+    typedef std::vector<std::vector<std::shared_ptr<Character>>> NestedBoard;
+
+    const double DENSITY = 0.25;
+
+    /**
+    * a stream buffer that drops everything written to it, so printing is timed without the cost of storing it.
+    */
+    class NullBuffer : public std::streambuf {
+    protected:
+        std::streamsize xsputn(const char*, std::streamsize count) override {
+            return count;
+        }
+        int overflow(int c) override {
+            return c;
+        }
+    };
+
+    std::shared_ptr<Character> makeRandomCharacter(std::mt19937& generator, int num_of_teams) {
+        CharacterType type = static_cast<CharacterType>(generator() % 3);
+        Team team = static_cast<Team>(generator() % num_of_teams);
+        return Game::makeCharacter(type, team, 10, 5, 4, 2);
+    }
+
+    /**
+    * the layout the game used before the board was stored in one array - a vector of rows of shared_ptr cells.
+    */
+    NestedBoard makeNestedBoard(int side, int num_of_teams) {
+        NestedBoard board(side, std::vector<std::shared_ptr<Character>>(side));
+        std::mt19937 generator(1);
+        std::bernoulli_distribution is_occupied(DENSITY);
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                if (is_occupied(generator))
+                {
+                    board[r][c] = makeRandomCharacter(generator, num_of_teams);
+                }
+            }
+        }
+        return board;
+    }
+
+    Game makeGame(int side, int num_of_teams) {
+        Game game(side, side);
+        std::mt19937 generator(1);
+        std::bernoulli_distribution is_occupied(DENSITY);
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                if (is_occupied(generator))
+                {
+                    game.addCharacter(GridPoint(r, c), makeRandomCharacter(generator, num_of_teams));
+                }
+            }
+        }
+        return game;
+    }
+
+    /**
+    * prints a nested board the way operator<< did before - one string of identifier chars passed to
+    * printGameBoard.
+    */
+    void printNestedBoard(std::ostream& os, const NestedBoard& board, int side) {
+        std::string output;
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                output += (board[r][c] == nullptr) ? ' ' : board[r][c]->getCharacterIdentifierChar();
+            }
+        }
+        printGameBoard(os, output.data(), output.data() + output.size(), side);
+    }
+
+    /**
+    * the full board scan isOver did before the live units counters. it stops at the first unit of a second team,
+    * so it scans the whole board when a single team is left.
+    */
+    bool isNestedBoardOver(const NestedBoard& board, int side) {
+        bool is_first = true;
+        Team first_team = POWERLIFTERS;
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                if (board[r][c] == nullptr)
+                {
+                    continue;
+                }
+                if (is_first)
+                {
+                    first_team = board[r][c]->getCharacterTeam();
+                    is_first = false;
+                }
+                else if (board[r][c]->getCharacterTeam() != first_team)
+                {
+                    return false;
+                }
+            }
+        }
+        return !is_first;
+    }
+
+    void BM_NestedBoardFootprint(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        unsigned long long bytes = 0;
+        for (auto _ : state)
+        {
+            unsigned long long bytes_before = AllocationCounter::getAllocatedBytes();
+            NestedBoard board = makeNestedBoard(side, 2);
+            bytes = AllocationCounter::getAllocatedBytes() - bytes_before;
+            benchmark::DoNotOptimize(board.data());
+        }
+        state.counters["bytes"] = static_cast<double>(bytes);
+    }
+
+    void BM_GameFootprint(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        unsigned long long bytes = 0;
+        for (auto _ : state)
+        {
+            unsigned long long bytes_before = AllocationCounter::getAllocatedBytes();
+            Game game = makeGame(side, 2);
+            bytes = AllocationCounter::getAllocatedBytes() - bytes_before;
+            benchmark::DoNotOptimize(&game);
+        }
+        state.counters["bytes"] = static_cast<double>(bytes);
+    }
+
+    void BM_NestedBoardIsOver(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        NestedBoard board = makeNestedBoard(side, 1);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(isNestedBoardOver(board, side));
+        }
+    }
+
+    void BM_GameIsOver(benchmark::State& state) {
+        Game game = makeGame(static_cast<int>(state.range(0)), 1);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(game.isOver());
+        }
+    }
+
+    void BM_NestedBoardPrint(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        NestedBoard board = makeNestedBoard(side, 2);
+        NullBuffer buffer;
+        std::ostream os(&buffer);
+        for (auto _ : state)
+        {
+            printNestedBoard(os, board, side);
+        }
+        state.SetItemsProcessed(state.iterations() * side * side);
+    }
+
+    void BM_GamePrint(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        Game game = makeGame(side, 2);
+        NullBuffer buffer;
+        std::ostream os(&buffer);
+        for (auto _ : state)
+        {
+            os << game;
+        }
+        state.SetItemsProcessed(state.iterations() * side * side);
+    }
+
+    void BM_GameCopy(benchmark::State& state) {
+        Game game = makeGame(static_cast<int>(state.range(0)), 2);
+        for (auto _ : state)
+        {
+            Game copy(game);
+            benchmark::DoNotOptimize(&copy);
+        }
+    }
+
+    /**
+    * forks the game and moves a single unit of the fork, so the time includes copying the tile and the character
+    * the move writes to.
+    */
+    void BM_GameForkAndMove(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        Game game = makeGame(side, 2);
+        GridPoint src(0, 0);
+        while (game.getCharacter(src) == nullptr)
+        {
+            src.col++;
+        }
+        std::vector<GridPoint> destinations;
+        game.legalMoves(src, destinations);
+        for (auto _ : state)
+        {
+            Game fork = game.fork();
+            benchmark::DoNotOptimize(fork.tryMove(src, destinations.front()));
+        }
+    }
+}
+
+BENCHMARK(BM_NestedBoardFootprint)->Arg(512)->Arg(2048)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GameFootprint)->Arg(512)->Arg(2048)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NestedBoardIsOver)->Arg(512)->Arg(2048)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GameIsOver)->Arg(512)->Arg(2048)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NestedBoardPrint)->Arg(512)->Arg(2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GamePrint)->Arg(512)->Arg(2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GameCopy)->Arg(512)->Arg(2048)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GameForkAndMove)->Arg(512)->Arg(2048)->Unit(benchmark::kMicrosecond);
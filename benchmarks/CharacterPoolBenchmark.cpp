@@ -0,0 +1,76 @@
+#include "AllocationCounter.h"
+#include "CharacterPool.h"
+#include "Game.h"
+#include "Soldier.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    const int WAVE_SIZE = 4096;
+
+    /**
+    * reports the global operator new calls and the pool counters of the current thread per iteration.
+    */
+    void reportAllocations(benchmark::State& state, unsigned long long first_allocations,
+                           const CharacterPool::Statistics& statistics) {
+        double iterations = static_cast<double>(state.iterations());
+        state.counters["new/iter"] = (AllocationCounter::getAllocations() - first_allocations) / iterations;
+        state.counters["pool/iter"] = statistics.pool_allocations / iterations;
+        state.counters["slabs/iter"] = statistics.slab_allocations / iterations;
+        state.SetItemsProcessed(state.iterations() * WAVE_SIZE);
+    }
+
+    /**
+    * spawns a wave of soldiers with std::make_shared, the way characters were created before the pool.
+    */
+    void BM_MakeSharedWave(benchmark::State& state) {
+        std::vector<std::shared_ptr<Character>> wave(WAVE_SIZE);
+        CharacterPool::resetThreadStatistics();
+        unsigned long long first_allocations = AllocationCounter::getAllocations();
+        for (auto _ : state)
+        {
+            for (std::shared_ptr<Character>& character : wave)
+            {
+                character = std::make_shared<Soldier>(10, 5, 3, 2, POWERLIFTERS);
+            }
+        }
+        reportAllocations(state, first_allocations, CharacterPool::getThreadStatistics());
+    }
+
+    void BM_MakeCharacterWave(benchmark::State& state) {
+        std::vector<std::shared_ptr<Character>> wave(WAVE_SIZE);
+        CharacterPool::resetThreadStatistics();
+        unsigned long long first_allocations = AllocationCounter::getAllocations();
+        for (auto _ : state)
+        {
+            for (std::shared_ptr<Character>& character : wave)
+            {
+                character = Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 3, 2);
+            }
+        }
+        reportAllocations(state, first_allocations, CharacterPool::getThreadStatistics());
+    }
+
+    void BM_CloneWave(benchmark::State& state) {
+        std::shared_ptr<Character> original = Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 3, 2);
+        std::vector<std::shared_ptr<Character>> wave(WAVE_SIZE);
+        CharacterPool::resetThreadStatistics();
+        unsigned long long first_allocations = AllocationCounter::getAllocations();
+        for (auto _ : state)
+        {
+            for (std::shared_ptr<Character>& character : wave)
+            {
+                character = original->clone();
+            }
+        }
+        reportAllocations(state, first_allocations, CharacterPool::getThreadStatistics());
+    }
+}
+
+BENCHMARK(BM_MakeSharedWave)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MakeCharacterWave)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CloneWave)->Unit(benchmark::kMicrosecond);
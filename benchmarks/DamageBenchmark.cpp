@@ -0,0 +1,87 @@
+#include "DamageKernel.h"
+#include "Game.h"
+#include "UnitStore.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    const units_t ENEMY_HEALTH = 1 << 30;
+
+    /**
+    * the arguments of the benchmarks are the side of a board whose cells, other than its center, are all taken by
+    * enemies of a soldier at the center. the strike area of the soldier covers the whole board, and every strike
+    * takes 1 health point from every unit it hits, so no unit dies while the benchmarks run.
+    */
+    Game makeBoard(int side) {
+        Game game(side, side);
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                if (r == side / 2 && c == side / 2)
+                {
+                    continue;
+                }
+                game.addCharacter(GridPoint(r, c), Game::makeCharacter(MEDIC, CROSSFITTERS, ENEMY_HEALTH, 1, 1, 1));
+            }
+        }
+        return game;
+    }
+
+    void makeUnits(int side, UnitStore& units, std::vector<units_t>& damage_field) {
+        Game board = makeBoard(side);
+        board.exportUnits(units);
+        units.computeAreaDamage(GridPoint(side / 2, side / 2), 2 * side, POWERLIFTERS, 1, damage_field);
+    }
+
+    void BM_DamageKernelPass(benchmark::State& state) {
+        UnitStore units;
+        std::vector<units_t> damage_field;
+        makeUnits(static_cast<int>(state.range(0)), units, damage_field);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(units.applyDamageField(damage_field));
+        }
+        state.SetItemsProcessed(state.iterations() * units.getSize());
+        state.SetLabel(DamageKernel::getInstructionSet());
+    }
+
+    void BM_UnitViewDamage(benchmark::State& state) {
+        UnitStore units;
+        std::vector<units_t> damage_field;
+        makeUnits(static_cast<int>(state.range(0)), units, damage_field);
+        for (auto _ : state)
+        {
+            int num_of_deaths = 0;
+            for (int unit_id = 0; unit_id < units.getSize(); unit_id++)
+            {
+                UnitView unit = units.getUnit(unit_id);
+                bool was_alive = unit.isCharacterAlive();
+                unit.setCharacterHealthPoints(-damage_field[unit_id]);
+                num_of_deaths += (was_alive && !unit.isCharacterAlive()) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(num_of_deaths);
+        }
+        state.SetItemsProcessed(state.iterations() * units.getSize());
+    }
+
+    void BM_GameAreaStrike(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        Game game = makeBoard(side);
+        GridPoint attacker(side / 2, side / 2);
+        game.addCharacter(attacker, Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 1 << 30, 3 * side, 2));
+        GridPoint target(side / 2, side / 2 + 1);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(game.tryAttack(attacker, target));
+        }
+        state.SetItemsProcessed(state.iterations() * (static_cast<long long>(side) * side - 1));
+    }
+}
+
+BENCHMARK(BM_DamageKernelPass)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_UnitViewDamage)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GameAreaStrike)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
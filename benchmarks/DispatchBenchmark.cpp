@@ -0,0 +1,83 @@
+#include "Game.h"
+#include "Soldier.h"
+#include "Medic.h"
+#include "Sniper.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    const int ROW_LENGTH = 64;
+    const int MAIN_TARGET_COL = 40;
+
+    /**
+    * the per cell work of an attack over a row of cells - the checks of performAttack on every cell, then the
+    * strike. AttackerType selects the calls like the performAttack instantiations do: the final built in classes
+    * bind them at compile time, and Character calls them through the vtable.
+    */
+    template <class AttackerType>
+    units_t strikeRow(AttackerType& attacker, const std::vector<std::shared_ptr<Character>>& row) {
+        GridPoint src_coordinates(0, 0);
+        GridPoint main_target_coordinates(0, MAIN_TARGET_COL);
+        units_t total = 0;
+        for (int c = 1; c < ROW_LENGTH; c++)
+        {
+            GridPoint current_coordinates(0, c);
+            const Character* target = row[c].get();
+            if (attacker.isTargetInStrikeRange(src_coordinates, current_coordinates) &&
+                attacker.isCharacterHasEnoughAmmo(target) &&
+                attacker.isStrikeLegal(src_coordinates, current_coordinates, target))
+            {
+                total += attacker.performStrike(src_coordinates, main_target_coordinates, current_coordinates,
+                                                target);
+            }
+        }
+        return total;
+    }
+
+    std::vector<std::shared_ptr<Character>> makeRow() {
+        std::vector<std::shared_ptr<Character>> row(ROW_LENGTH);
+        for (int c = 1; c < ROW_LENGTH; c++)
+        {
+            if (c % 3 != 0)
+            {
+                row[c] = Game::makeCharacter(static_cast<CharacterType>(c % 3), static_cast<Team>(c % 2), 10, 1, 1, 1);
+            }
+        }
+        return row;
+    }
+
+    template <class Type, CharacterType type>
+    void BM_DevirtualizedStrike(benchmark::State& state) {
+        std::shared_ptr<Character> attacker = Game::makeCharacter(type, POWERLIFTERS, 10, 1 << 30, ROW_LENGTH, 1);
+        std::vector<std::shared_ptr<Character>> row = makeRow();
+        Type& typed_attacker = static_cast<Type&>(*attacker);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(strikeRow(typed_attacker, row));
+        }
+        state.SetItemsProcessed(state.iterations() * (ROW_LENGTH - 1));
+    }
+
+    template <class Type, CharacterType type>
+    void BM_VirtualStrike(benchmark::State& state) {
+        std::shared_ptr<Character> attacker = Game::makeCharacter(type, POWERLIFTERS, 10, 1 << 30, ROW_LENGTH, 1);
+        std::vector<std::shared_ptr<Character>> row = makeRow();
+        Character& virtual_attacker = *attacker;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(strikeRow(virtual_attacker, row));
+        }
+        state.SetItemsProcessed(state.iterations() * (ROW_LENGTH - 1));
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_DevirtualizedStrike, Soldier, SOLDIER);
+BENCHMARK_TEMPLATE(BM_VirtualStrike, Soldier, SOLDIER);
+BENCHMARK_TEMPLATE(BM_DevirtualizedStrike, Medic, MEDIC);
+BENCHMARK_TEMPLATE(BM_VirtualStrike, Medic, MEDIC);
+BENCHMARK_TEMPLATE(BM_DevirtualizedStrike, Sniper, SNIPER);
+BENCHMARK_TEMPLATE(BM_VirtualStrike, Sniper, SNIPER);
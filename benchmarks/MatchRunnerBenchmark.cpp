@@ -0,0 +1,65 @@
+#include "MatchRunner.h"
+#include "RandomPolicy.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    Game makeBoard() {
+        Game game(64, 64);
+        std::mt19937 generator(1);
+        for (int r = 0; r < 64; r++)
+        {
+            for (int c = 0; c < 64; c++)
+            {
+                if (generator() % 4 == 0)
+                {
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(
+                            static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                            10, 3, 4, 2));
+                }
+            }
+        }
+        return game;
+    }
+
+    void BM_MatchRunnerScaling(benchmark::State& state) {
+        Game board = makeBoard();
+        MatchRunner runner(static_cast<int>(state.range(0)));
+        std::vector<MatchResult> results;
+        long long num_of_matches = 0;
+        long long num_of_turns = 0;
+        for (auto _ : state)
+        {
+            runner.run(64, [&board](int) { return board.fork(); },
+                       [](int match_index, Team team) -> std::unique_ptr<TeamPolicy> {
+                           return std::unique_ptr<TeamPolicy>(new RandomPolicy(match_index * 2 + team));
+                       }, 1000, results);
+            num_of_matches += static_cast<long long>(results.size());
+            for (const MatchResult& result : results)
+            {
+                num_of_turns += result.num_of_turns;
+            }
+        }
+        state.counters["games/s"] = benchmark::Counter(static_cast<double>(num_of_matches),
+                                                       benchmark::Counter::kIsRate);
+        state.counters["turns/s"] = benchmark::Counter(static_cast<double>(num_of_turns),
+                                                       benchmark::Counter::kIsRate);
+    }
+
+    void applyThreadCounts(benchmark::internal::Benchmark* benchmark) {
+        int num_of_cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        for (int num_of_threads = 1; num_of_threads < num_of_cores; num_of_threads *= 2)
+        {
+            benchmark->Arg(num_of_threads);
+        }
+        benchmark->Arg(num_of_cores);
+    }
+}
+
+BENCHMARK(BM_MatchRunnerScaling)->Apply(applyThreadCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
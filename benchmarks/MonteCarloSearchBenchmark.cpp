@@ -0,0 +1,59 @@
+#include "MonteCarloSearch.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <thread>
+
+using namespace mtm;
+
+namespace
+{
+    Game makeBoard(int side) {
+        Game game(side, side);
+        std::mt19937 generator(1);
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                if (generator() % 4 == 0)
+                {
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(
+                            static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                            10, 3, 4, 2));
+                }
+            }
+        }
+        return game;
+    }
+
+    /**
+    * the rollouts of a search on a board that is a quarter full. the rollouts are long enough for the per step
+    * cost of picking a unit to dominate - it was a full export of the board before the rollouts tracked the
+    * units of the teams.
+    */
+    void BM_MonteCarloSearch(benchmark::State& state) {
+        Game board = makeBoard(static_cast<int>(state.range(0)));
+        MonteCarloSearch search(static_cast<int>(state.range(1)), 200, 1);
+        Action action(RELOAD_ACTION, GridPoint(0, 0), GridPoint(0, 0));
+        double rollouts_per_second = 0;
+        for (auto _ : state)
+        {
+            search.search(board, POWERLIFTERS, 32, action);
+            rollouts_per_second += search.getRolloutsPerSecond();
+        }
+        state.counters["rollouts/s/core"] = rollouts_per_second / static_cast<double>(state.iterations());
+    }
+
+    void applyBoardsAndThreads(benchmark::internal::Benchmark* benchmark) {
+        int num_of_cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        for (int side : {32, 128})
+        {
+            benchmark->Args({side, 1});
+            if (num_of_cores > 1)
+            {
+                benchmark->Args({side, num_of_cores});
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_MonteCarloSearch)->Apply(applyBoardsAndThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
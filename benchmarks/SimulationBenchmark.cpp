@@ -0,0 +1,28 @@
+#include "Simulation.h"
+#include <benchmark/benchmark.h>
+
+using namespace mtm;
+
+namespace
+{
+    void BM_RandomMatches(benchmark::State& state) {
+        SimulationConfig config;
+        config.height = static_cast<int>(state.range(0));
+        config.width = static_cast<int>(state.range(0));
+        config.num_of_matches = 4;
+        config.max_turns = 500;
+        config.num_of_threads = 1;
+        config.num_of_copies = 0;
+        config.num_of_renders = 0;
+        Simulation simulation(config);
+        long long num_of_actions = 0;
+        for (auto _ : state)
+        {
+            num_of_actions += simulation.run().num_of_actions;
+        }
+        state.counters["actions/s"] = benchmark::Counter(static_cast<double>(num_of_actions),
+                                                         benchmark::Counter::kIsRate);
+    }
+}
+
+BENCHMARK(BM_RandomMatches)->Arg(32)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+#include "GameSnapshot.h"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    const double DENSITY = 0.25;
+
+    /**
+    * the arguments of the benchmarks are the side of a board a quarter of whose cells are taken by random units,
+    * the size of a large checkpoint.
+    */
+    Game makeGame(int side) {
+        Game game(side, side);
+        std::mt19937 generator(1);
+        std::bernoulli_distribution is_occupied(DENSITY);
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                if (is_occupied(generator))
+                {
+                    CharacterType type = static_cast<CharacterType>(generator() % 3);
+                    Team team = static_cast<Team>(generator() % 2);
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(type, team, 10, 5, 4, 2));
+                }
+            }
+        }
+        return game;
+    }
+
+    void BM_DeserializeSnapshot(benchmark::State& state) {
+        std::vector<char> data;
+        GameSnapshot::serialize(makeGame(static_cast<int>(state.range(0))), data);
+        for (auto _ : state)
+        {
+            Game game = GameSnapshot::deserialize(data.data(), data.size());
+            benchmark::DoNotOptimize(game.getPositionHash());
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+    }
+
+    void BM_LoadSnapshotFile(benchmark::State& state) {
+        Game saved_game = makeGame(static_cast<int>(state.range(0)));
+        std::string path = "snapshot_benchmark_load_" + std::to_string(state.range(0)) + ".rpgs";
+        GameSnapshot::saveToFile(saved_game, path);
+        for (auto _ : state)
+        {
+            Game game = GameSnapshot::loadFromFile(path);
+            benchmark::DoNotOptimize(game.getPositionHash());
+        }
+        std::remove(path.c_str());
+        std::vector<char> data;
+        GameSnapshot::serialize(saved_game, data);
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+    }
+
+    void BM_SaveSnapshotFile(benchmark::State& state) {
+        Game game = makeGame(static_cast<int>(state.range(0)));
+        std::string path = "snapshot_benchmark_save_" + std::to_string(state.range(0)) + ".rpgs";
+        for (auto _ : state)
+        {
+            GameSnapshot::saveToFile(game, path);
+        }
+        std::remove(path.c_str());
+        std::vector<char> data;
+        GameSnapshot::serialize(game, data);
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+    }
+}
+
+BENCHMARK(BM_DeserializeSnapshot)->Arg(512)->Arg(2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadSnapshotFile)->Arg(512)->Arg(2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SaveSnapshotFile)->Arg(512)->Arg(2048)->Unit(benchmark::kMillisecond);
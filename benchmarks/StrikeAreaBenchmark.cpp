@@ -0,0 +1,62 @@
+#include "Game.h"
+#include <benchmark/benchmark.h>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * a board with a quarter of its cells taken by enemies of a soldier at its center. the enemies are on the even
+    * rows, and the soldier on an odd row.
+    */
+    Game makeBoard(int side, units_t range) {
+        Game game(side, side);
+        for (int r = 0; r < side; r += 2)
+        {
+            for (int c = r % 4 == 0 ? 0 : 1; c < side; c += 2)
+            {
+                game.addCharacter(GridPoint(r, c), Game::makeCharacter(MEDIC, CROSSFITTERS, 1000, 1, 1, 1));
+            }
+        }
+        game.addCharacter(GridPoint(side / 2 + 1, side / 2),
+                          Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 1 << 30, range, 1));
+        return game;
+    }
+
+    /**
+    * the arguments are the side of the board, the range of the soldier and the number of strike threads.
+    */
+    void BM_SoldierStrikeArea(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        Game board = makeBoard(side, static_cast<units_t>(state.range(1)));
+        board.setStrikeThreads(static_cast<int>(state.range(2)));
+        GridPoint attacker(side / 2 + 1, side / 2);
+        GridPoint target(side / 2 + 1, side / 2 + 1);
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            Game game = board.fork();
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(game.tryAttack(attacker, target));
+        }
+    }
+
+    void applySweep(benchmark::internal::Benchmark* benchmark) {
+        const int sides[] = {256, 1024, 2048};
+        const int ranges[] = {30, 300, 3000};
+        const int thread_counts[] = {1, 4};
+        for (int side : sides)
+        {
+            for (int range : ranges)
+            {
+                for (int num_of_threads : thread_counts)
+                {
+                    benchmark->Args({side, range, num_of_threads});
+                }
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_SoldierStrikeArea)->Apply(applySweep)->ArgNames({"side", "range", "threads"})->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
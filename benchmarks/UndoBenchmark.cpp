@@ -0,0 +1,137 @@
+#include "AllocationCounter.h"
+#include "Game.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    const int NUM_OF_CANDIDATES = 12;
+    const int SEARCH_DEPTH = 3;
+
+    Game makeBoard(int side) {
+        Game game(side, side);
+        std::mt19937 generator(1);
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = 0; c < side; c++)
+            {
+                if (generator() % 3 == 0)
+                {
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(
+                            static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                            10, 3, 4, 2));
+                }
+            }
+        }
+        return game;
+    }
+
+    /**
+    * the actions that every node of the search tries - the first legal attacks, moves and reloads of the root.
+    * deeper in the tree some of them are no longer legal and are skipped.
+    */
+    std::vector<Action> makeCandidates(const Game& game, int side) {
+        std::vector<Action> candidates;
+        std::vector<GridPoint> cells;
+        for (int r = 0; r < side && static_cast<int>(candidates.size()) < NUM_OF_CANDIDATES; r++)
+        {
+            for (int c = 0; c < side && static_cast<int>(candidates.size()) < NUM_OF_CANDIDATES; c++)
+            {
+                GridPoint coordinates(r, c);
+                game.legalTargets(coordinates, cells);
+                if (!cells.empty())
+                {
+                    candidates.push_back(Action(ATTACK_ACTION, coordinates, cells[0]));
+                    candidates.push_back(Action(RELOAD_ACTION, coordinates, coordinates));
+                }
+                game.legalMoves(coordinates, cells);
+                if (!cells.empty())
+                {
+                    candidates.push_back(Action(MOVE_ACTION, coordinates, cells.back()));
+                }
+            }
+        }
+        return candidates;
+    }
+
+    long long searchWithUndo(Game& game, const std::vector<Action>& candidates, int depth) {
+        if (depth == 0)
+        {
+            return 0;
+        }
+        long long num_of_nodes = 0;
+        for (const Action& action : candidates)
+        {
+            if (game.tryAction(action) == ACTION_SUCCESS)
+            {
+                num_of_nodes += 1 + searchWithUndo(game, candidates, depth - 1);
+                game.undo();
+            }
+        }
+        return num_of_nodes;
+    }
+
+    long long searchWithCopies(const Game& game, const std::vector<Action>& candidates, int depth) {
+        if (depth == 0)
+        {
+            return 0;
+        }
+        long long num_of_nodes = 0;
+        for (const Action& action : candidates)
+        {
+            Game child(game);
+            if (child.tryAction(action) == ACTION_SUCCESS)
+            {
+                num_of_nodes += 1 + searchWithCopies(child, candidates, depth - 1);
+            }
+        }
+        return num_of_nodes;
+    }
+
+    void reportNodes(benchmark::State& state, long long num_of_nodes, unsigned long long first_allocations) {
+        state.counters["nodes/s"] = benchmark::Counter(static_cast<double>(num_of_nodes), benchmark::Counter::kIsRate);
+        state.counters["new/node"] = num_of_nodes > 0 ?
+                static_cast<double>(AllocationCounter::getAllocations() - first_allocations) / num_of_nodes : 0;
+    }
+
+    /**
+    * a depth-first search that performs every action on the same game and reverts it with undo. the first
+    * iteration grows the undo records to the depth of the search, and is not counted.
+    */
+    void BM_SearchWithUndo(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        Game game = makeBoard(side);
+        std::vector<Action> candidates = makeCandidates(game, side);
+        game.setUndoEnabled(true);
+        searchWithUndo(game, candidates, SEARCH_DEPTH);
+        long long num_of_nodes = 0;
+        unsigned long long first_allocations = AllocationCounter::getAllocations();
+        for (auto _ : state)
+        {
+            num_of_nodes += searchWithUndo(game, candidates, SEARCH_DEPTH);
+        }
+        reportNodes(state, num_of_nodes, first_allocations);
+    }
+
+    /**
+    * the same search, with a full copy of the game for every node - the only way back before undo.
+    */
+    void BM_SearchWithCopies(benchmark::State& state) {
+        int side = static_cast<int>(state.range(0));
+        Game game = makeBoard(side);
+        std::vector<Action> candidates = makeCandidates(game, side);
+        long long num_of_nodes = 0;
+        unsigned long long first_allocations = AllocationCounter::getAllocations();
+        for (auto _ : state)
+        {
+            num_of_nodes += searchWithCopies(game, candidates, SEARCH_DEPTH);
+        }
+        reportNodes(state, num_of_nodes, first_allocations);
+    }
+}
+
+BENCHMARK(BM_SearchWithUndo)->Arg(16)->Arg(128)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SearchWithCopies)->Arg(16)->Arg(128)->Unit(benchmark::kMicrosecond);
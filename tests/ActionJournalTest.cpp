@@ -0,0 +1,96 @@
+#include "ActionJournal.h"
+#include "LittleEndian.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    std::string printBoard(const Game& game) {
+        std::ostringstream os;
+        os << game;
+        return os.str();
+    }
+
+    Game makeBoard() {
+        Game game(6, 6);
+        game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 4, 2));
+        game.addCharacter(GridPoint(3, 2), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 2, 1));
+        return game;
+    }
+}
+
+TEST(ActionJournalTest, ReplaysUndoneActions) {
+    Game game = makeBoard();
+    game.setUndoEnabled(true);
+    ActionJournal journal(game, 0);
+    game.setJournal(&journal);
+    game.move(GridPoint(0, 0), GridPoint(0, 2));
+    ASSERT_TRUE(game.undo());
+    game.move(GridPoint(0, 0), GridPoint(3, 0));
+    game.attack(GridPoint(3, 0), GridPoint(3, 2));
+    game.reload(GridPoint(3, 2));
+    ActionJournal loaded(journal.getData().data(), journal.getData().size());
+    Game replayed = loaded.replay();
+    EXPECT_EQ(printBoard(game), printBoard(replayed));
+    EXPECT_EQ(game.getPositionHash(), replayed.getPositionHash());
+    EXPECT_EQ(4u, loaded.getNumOfActions());
+}
+
+TEST(ActionJournalTest, RejectsActionsThatDoNotFitTheBoard) {
+    Game game = makeBoard();
+    ActionJournal journal(game, 0);
+    game.setJournal(&journal);
+    size_t move_position = journal.getData().size();
+    game.move(GridPoint(0, 0), GridPoint(0, 2));
+    std::vector<char> data = journal.getData();
+    data[move_position + 4] = 1;
+    ActionJournal empty_source(data.data(), data.size());
+    EXPECT_THROW(empty_source.replay(), InvalidSnapshot);
+    data = journal.getData();
+    data[move_position + 12] = 100;
+    ActionJournal outside_board(data.data(), data.size());
+    EXPECT_THROW(outside_board.replay(), InvalidSnapshot);
+}
+
+TEST(ActionJournalTest, RejectsMalformedEntries) {
+    Game game = makeBoard();
+    ActionJournal journal(game, 0);
+    game.setJournal(&journal);
+    size_t add_position = journal.getData().size();
+    game.addCharacter(GridPoint(5, 5), Game::makeCharacter(SNIPER, CROSSFITTERS, 10, 5, 2, 1));
+    std::vector<char> data = journal.getData();
+    data[add_position + 9] = 7;
+    EXPECT_THROW(ActionJournal(data.data(), data.size()), InvalidSnapshot);
+    data = journal.getData();
+    data[add_position + 10] = 2;
+    EXPECT_THROW(ActionJournal(data.data(), data.size()), InvalidSnapshot);
+    data = journal.getData();
+    LittleEndian::overwriteUint64(data.data() + 8 + 9, ~uint64_t(0) - 8);
+    EXPECT_THROW(ActionJournal(data.data(), data.size()), InvalidSnapshot);
+}
+
+TEST(ActionJournalTest, TrustedAndLoadedReplaysAgree) {
+    Game game = makeBoard();
+    ActionJournal journal(game, 2);
+    game.setJournal(&journal);
+    game.move(GridPoint(0, 0), GridPoint(3, 0));
+    game.attack(GridPoint(3, 0), GridPoint(3, 2));
+    game.reload(GridPoint(3, 2));
+    game.addCharacter(GridPoint(5, 5), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 5, 4, 2));
+    game.attack(GridPoint(3, 0), GridPoint(3, 2));
+    ActionJournal loaded(journal.getData().data(), journal.getData().size());
+    EXPECT_TRUE(journal.isTrusted());
+    EXPECT_FALSE(loaded.isTrusted());
+    for (uint64_t num_of_actions = 0; num_of_actions <= journal.getNumOfActions(); num_of_actions++)
+    {
+        Game trusted_replay = journal.replay(num_of_actions);
+        Game checked_replay = loaded.replay(num_of_actions);
+        EXPECT_EQ(printBoard(trusted_replay), printBoard(checked_replay));
+        EXPECT_EQ(trusted_replay.getPositionHash(), checked_replay.getPositionHash());
+    }
+    EXPECT_EQ(printBoard(game), printBoard(journal.replay()));
+}
@@ -0,0 +1,103 @@
+#include "Game.h"
+#include "Exceptions.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    Game makeBoard() {
+        Game game(8, 8);
+        game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+        game.addCharacter(GridPoint(1, 1), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 0, 5, 1));
+        game.addCharacter(GridPoint(1, 3), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 2, 1));
+        game.addCharacter(GridPoint(7, 7), Game::makeCharacter(SNIPER, CROSSFITTERS, 10, 5, 2, 1));
+        return game;
+    }
+
+    std::string printBoard(const Game& game) {
+        std::ostringstream os;
+        os << game;
+        return os.str();
+    }
+}
+
+TEST(ActionStatusTest, RejectedActionsReturnTheStatusOfTheirException) {
+    Game game = makeBoard();
+    std::string board = printBoard(game);
+    EXPECT_EQ(ACTION_ILLEGAL_CELL, game.tryMove(GridPoint(0, 0), GridPoint(8, 0)));
+    EXPECT_THROW(game.move(GridPoint(0, 0), GridPoint(8, 0)), IllegalCell);
+    EXPECT_EQ(ACTION_CELL_EMPTY, game.tryReload(GridPoint(5, 5)));
+    EXPECT_THROW(game.reload(GridPoint(5, 5)), CellEmpty);
+    EXPECT_EQ(ACTION_MOVE_TOO_FAR, game.tryMove(GridPoint(0, 0), GridPoint(7, 0)));
+    EXPECT_THROW(game.move(GridPoint(0, 0), GridPoint(7, 0)), MoveTooFar);
+    EXPECT_EQ(ACTION_CELL_OCCUPIED, game.tryMove(GridPoint(0, 0), GridPoint(1, 1)));
+    EXPECT_THROW(game.move(GridPoint(0, 0), GridPoint(1, 1)), CellOccupied);
+    EXPECT_EQ(ACTION_OUT_OF_RANGE, game.tryAttack(GridPoint(0, 0), GridPoint(7, 7)));
+    EXPECT_THROW(game.attack(GridPoint(0, 0), GridPoint(7, 7)), OutOfRange);
+    EXPECT_EQ(ACTION_OUT_OF_AMMO, game.tryAttack(GridPoint(1, 1), GridPoint(1, 3)));
+    EXPECT_THROW(game.attack(GridPoint(1, 1), GridPoint(1, 3)), OutOfAmmo);
+    EXPECT_EQ(board, printBoard(game));
+}
+
+TEST(ActionStatusTest, SuccessfulTryActionChangesTheBoard) {
+    Game game = makeBoard();
+    EXPECT_EQ(ACTION_SUCCESS, game.tryMove(GridPoint(0, 0), GridPoint(0, 2)));
+    EXPECT_EQ(ACTION_CELL_EMPTY, game.tryReload(GridPoint(0, 0)));
+    EXPECT_EQ(ACTION_SUCCESS, game.tryReload(GridPoint(0, 2)));
+}
+
+TEST(ActionStatusTest, BatchMatchesTheSameActionsOneAtATime) {
+    Game batch_game = makeBoard();
+    Game single_game = makeBoard();
+    std::vector<Action> actions = {
+            Action(MOVE_ACTION, GridPoint(0, 0), GridPoint(8, 0)),
+            Action(ATTACK_ACTION, GridPoint(1, 1), GridPoint(1, 3)),
+            Action(RELOAD_ACTION, GridPoint(1, 1), GridPoint(1, 1)),
+            Action(ATTACK_ACTION, GridPoint(1, 1), GridPoint(1, 3)),
+            Action(MOVE_ACTION, GridPoint(0, 0), GridPoint(1, 1)),
+            Action(MOVE_ACTION, GridPoint(0, 0), GridPoint(0, 2)),
+            Action(RELOAD_ACTION, GridPoint(5, 5), GridPoint(5, 5)),
+            Action(ATTACK_ACTION, GridPoint(1, 3), GridPoint(1, 1)),
+            Action(ATTACK_ACTION, GridPoint(0, 2), GridPoint(7, 7))};
+    std::vector<ActionStatus> results;
+    batch_game.setUndoEnabled(true);
+    std::string board_before = printBoard(batch_game);
+    uint64_t hash_before = batch_game.getPositionHash();
+    unsigned long long version_before = batch_game.getBoardVersion();
+    batch_game.applyBatch(actions, results);
+    ASSERT_EQ(actions.size(), results.size());
+    int num_of_successes = 0;
+    for (size_t i = 0; i < actions.size(); i++)
+    {
+        EXPECT_EQ(single_game.tryAction(actions[i]), results[i]);
+        num_of_successes += (results[i] == ACTION_SUCCESS);
+    }
+    EXPECT_LT(0, num_of_successes);
+    EXPECT_GT(static_cast<int>(actions.size()), num_of_successes);
+    EXPECT_EQ(single_game.getPositionHash(), batch_game.getPositionHash());
+    EXPECT_EQ(printBoard(single_game), printBoard(batch_game));
+    EXPECT_EQ(version_before + 1, batch_game.getBoardVersion());
+    EXPECT_TRUE(batch_game.undo());
+    EXPECT_EQ(hash_before, batch_game.getPositionHash());
+    EXPECT_EQ(board_before, printBoard(batch_game));
+    EXPECT_FALSE(batch_game.undo());
+}
+
+TEST(ActionStatusTest, BatchWithoutSuccessesDoesNotChangeTheGame) {
+    Game game = makeBoard();
+    game.setUndoEnabled(true);
+    unsigned long long version_before = game.getBoardVersion();
+    std::vector<Action> actions = {Action(RELOAD_ACTION, GridPoint(5, 5), GridPoint(5, 5)),
+                                   Action(MOVE_ACTION, GridPoint(0, 0), GridPoint(7, 0))};
+    std::vector<ActionStatus> results;
+    game.applyBatch(actions, results);
+    ASSERT_EQ(2u, results.size());
+    EXPECT_EQ(ACTION_CELL_EMPTY, results[0]);
+    EXPECT_EQ(ACTION_MOVE_TOO_FAR, results[1]);
+    EXPECT_EQ(version_before, game.getBoardVersion());
+    EXPECT_FALSE(game.undo());
+}
@@ -0,0 +1,148 @@
+#include "Game.h"
+#include "Instrumentation.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * a character class that is not built in. it keeps the default strike area radius and damages every enemy
+    * on the board by its power.
+    */
+    class Bomber : public Character {
+    public:
+        Bomber(units_t health, units_t power, Team team) :
+                Character(health, 1, 100, power, team, 1, 1, 0, 'B', 'b', SOLDIER)
+        {}
+
+        std::shared_ptr<Character> clone() const override {
+            return std::make_shared<Bomber>(*this);
+        }
+
+        bool isTargetInStrikeRange(const GridPoint&, const GridPoint&) const override {
+            return true;
+        }
+
+        bool isStrikeLegal(const GridPoint&, const GridPoint&, const Character*) const override {
+            return true;
+        }
+
+        units_t performStrike(const GridPoint&, const GridPoint&, const GridPoint&, const Character* target) override {
+            if (target == nullptr || target->getCharacterTeam() == getCharacterTeam())
+            {
+                return 0;
+            }
+            return -getCharacterPower();
+        }
+    };
+}
+
+TEST(AttackTest, ExtensionCharacterStrikesTheWholeBoardByDefault) {
+    Game game(40, 40);
+    game.addCharacter(GridPoint(0, 0), std::make_shared<Bomber>(10, 3, POWERLIFTERS));
+    game.addCharacter(GridPoint(0, 1), Game::makeCharacter(MEDIC, CROSSFITTERS, 3, 1, 1, 1));
+    game.addCharacter(GridPoint(39, 39), Game::makeCharacter(SOLDIER, CROSSFITTERS, 3, 1, 1, 1));
+    game.addCharacter(GridPoint(20, 5), Game::makeCharacter(SNIPER, CROSSFITTERS, 5, 1, 1, 1));
+    game.addCharacter(GridPoint(39, 0), Game::makeCharacter(SNIPER, POWERLIFTERS, 5, 1, 1, 1));
+    game.attack(GridPoint(0, 0), GridPoint(0, 1));
+    Team winner = CROSSFITTERS;
+    EXPECT_FALSE(game.isOver(&winner));
+    game.attack(GridPoint(0, 0), GridPoint(20, 5));
+    EXPECT_TRUE(game.isOver(&winner));
+    EXPECT_EQ(POWERLIFTERS, winner);
+}
+
+TEST(AttackTest, SoldierSecondaryStrikeStaysInsideItsArea) {
+    Game game(10, 10);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 6, 4));
+    game.addCharacter(GridPoint(0, 6), Game::makeCharacter(MEDIC, CROSSFITTERS, 4, 1, 1, 1));
+    game.addCharacter(GridPoint(1, 6), Game::makeCharacter(MEDIC, CROSSFITTERS, 2, 1, 1, 1));
+    game.addCharacter(GridPoint(9, 9), Game::makeCharacter(MEDIC, CROSSFITTERS, 2, 1, 1, 1));
+    game.attack(GridPoint(0, 0), GridPoint(0, 6));
+    std::vector<CellUpdate> updates;
+    ASSERT_TRUE(game.getBoardChanges(4, updates));
+    ASSERT_EQ(3u, updates.size());
+    EXPECT_EQ(' ', updates[1].identifier_char);
+    EXPECT_EQ(' ', updates[2].identifier_char);
+    EXPECT_FALSE(game.isOver());
+}
+
+TEST(AttackTest, ParallelStrikeAreaMatchesTheSerialStrike) {
+    const int side = 600;
+    Game serial_game(side, side);
+    for (int r = 0; r < side; r += 3)
+    {
+        for (int c = (r / 3) % 2; c < side; c += 2)
+        {
+            Team team = (r + c) % 5 == 0 ? POWERLIFTERS : CROSSFITTERS;
+            serial_game.addCharacter(GridPoint(r, c), Game::makeCharacter(static_cast<CharacterType>(c % 3), team,
+                                                                          1 + (r + c) % 4, 1, 1, 1));
+        }
+    }
+    GridPoint attacker(301, 300);
+    serial_game.addCharacter(attacker, Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 1500, 4));
+    Game parallel_game(serial_game);
+    parallel_game.setStrikeThreads(4);
+    unsigned long long serial_version = serial_game.getBoardVersion();
+    unsigned long long parallel_version = parallel_game.getBoardVersion();
+    serial_game.attack(attacker, GridPoint(301, 310));
+    parallel_game.attack(attacker, GridPoint(301, 310));
+    EXPECT_EQ(serial_game.getPositionHash(), parallel_game.getPositionHash());
+    std::ostringstream serial_board;
+    std::ostringstream parallel_board;
+    serial_board << serial_game;
+    parallel_board << parallel_game;
+    EXPECT_EQ(serial_board.str(), parallel_board.str());
+    std::vector<CellUpdate> serial_updates;
+    std::vector<CellUpdate> parallel_updates;
+    ASSERT_TRUE(serial_game.getBoardChanges(serial_version, serial_updates));
+    ASSERT_TRUE(parallel_game.getBoardChanges(parallel_version, parallel_updates));
+    ASSERT_EQ(serial_updates.size(), parallel_updates.size());
+    EXPECT_LT(1000u, serial_updates.size());
+    for (size_t i = 0; i < serial_updates.size(); i++)
+    {
+        EXPECT_EQ(serial_updates[i].coordinates, parallel_updates[i].coordinates);
+        EXPECT_EQ(serial_updates[i].identifier_char, parallel_updates[i].identifier_char);
+    }
+    Team serial_winner = CROSSFITTERS;
+    Team parallel_winner = POWERLIFTERS;
+    EXPECT_EQ(serial_game.isOver(&serial_winner), parallel_game.isOver(&parallel_winner));
+}
+
+TEST(AttackTest, SingleTargetStrikesHaveNoArea) {
+    EXPECT_EQ(0, Game::makeCharacter(MEDIC, POWERLIFTERS, 10, 5, 6, 4)->getCharacterStrikeAreaRadius());
+    EXPECT_EQ(0, Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 5, 6, 4)->getCharacterStrikeAreaRadius());
+}
+
+TEST(AttackTest, MedicAndSniperStrikesVisitOnlyTheTargetCell) {
+    if (!Instrumentation::isCompiledIn())
+    {
+        GTEST_SKIP();
+    }
+    for (int side : {8, 512})
+    {
+        Game game(side, side);
+        game.addCharacter(GridPoint(0, 0), Game::makeCharacter(MEDIC, POWERLIFTERS, 10, 5, 6, 4));
+        game.addCharacter(GridPoint(1, 0), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 5, 6, 4));
+        for (int r = 0; r < side; r++)
+        {
+            for (int c = (r < 2 ? 1 : 0); c < side; c++)
+            {
+                game.addCharacter(GridPoint(r, c), Game::makeCharacter(SOLDIER, CROSSFITTERS, 100, 1, 1, 1));
+            }
+        }
+        game.setStrikeThreads(4);
+        for (int attacker_row : {0, 1})
+        {
+            Instrumentation::reset();
+            game.attack(GridPoint(attacker_row, 0), GridPoint(attacker_row, 4));
+            InstrumentationSnapshot snapshot;
+            Instrumentation::getSnapshot(snapshot);
+            EXPECT_EQ(1u, snapshot.counters[CELLS_VISITED_COUNTER]);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#include "Game.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace mtm;
+
+TEST(BoardChangesTest, ReportsTheChangedCells) {
+    Game game(10, 10);
+    unsigned long long version = game.getBoardVersion();
+    game.addCharacter(GridPoint(2, 3), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+    game.move(GridPoint(2, 3), GridPoint(4, 3));
+    std::vector<CellUpdate> updates;
+    ASSERT_TRUE(game.getBoardChanges(version, updates));
+    ASSERT_EQ(2u, updates.size());
+    EXPECT_EQ(GridPoint(2, 3), updates[0].coordinates);
+    EXPECT_EQ(' ', updates[0].identifier_char);
+    EXPECT_EQ(GridPoint(4, 3), updates[1].coordinates);
+    EXPECT_EQ('S', updates[1].identifier_char);
+}
+
+TEST(BoardChangesTest, CellIndexesPastIntRange) {
+    const int side = 50000;
+    Game game(side, side);
+    unsigned long long version = game.getBoardVersion();
+    game.addCharacter(GridPoint(side - 1, side - 1), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 2, 1));
+    game.addCharacter(GridPoint(side - 1, 0), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 5, 2, 1));
+    std::vector<CellUpdate> updates;
+    ASSERT_TRUE(game.getBoardChanges(version, updates));
+    ASSERT_EQ(2u, updates.size());
+    EXPECT_EQ(GridPoint(side - 1, 0), updates[0].coordinates);
+    EXPECT_EQ('N', updates[0].identifier_char);
+    EXPECT_EQ(GridPoint(side - 1, side - 1), updates[1].coordinates);
+    EXPECT_EQ('m', updates[1].identifier_char);
+}
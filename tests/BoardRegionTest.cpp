@@ -0,0 +1,81 @@
+#include "Game.h"
+#include "Exceptions.h"
+#include <gtest/gtest.h>
+#include <climits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * places units of every type and team on the board at scattered cells.
+    */
+    void fillBoard(Game& game, int height, int width) {
+        const CharacterType types[] = {SOLDIER, MEDIC, SNIPER};
+        for (int r = 0; r < height; r++)
+        {
+            for (int c = 0; c < width; c++)
+            {
+                if ((r * 7 + c * 3) % 5 == 0)
+                {
+                    Team team = ((r + c) % 2 == 0) ? POWERLIFTERS : CROSSFITTERS;
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(types[(r + c) % 3], team, 10, 5, 2, 1));
+                }
+            }
+        }
+    }
+
+    /**
+    * prints a rectangle of the board with printGameBoard, from the cells of the rectangle read one by one.
+    */
+    std::string printSlice(const Game& game, const GridPoint& top_left, int num_of_rows, int num_of_cols) {
+        std::vector<char> cells;
+        for (int r = top_left.row; r < top_left.row + num_of_rows; r++)
+        {
+            for (int c = top_left.col; c < top_left.col + num_of_cols; c++)
+            {
+                const Character* character = game.getCharacter(GridPoint(r, c));
+                cells.push_back((character == nullptr) ? ' ' : character->getCharacterIdentifierChar());
+            }
+        }
+        std::ostringstream os;
+        printGameBoard(os, cells.data(), cells.data() + cells.size(), num_of_cols);
+        return os.str();
+    }
+
+    std::string printRegion(const Game& game, const GridPoint& top_left, int num_of_rows, int num_of_cols) {
+        std::ostringstream os;
+        game.printBoardRegion(os, top_left, num_of_rows, num_of_cols);
+        return os.str();
+    }
+}
+
+TEST(BoardRegionTest, RegionsMatchTheSliceOfTheBoard) {
+    Game game(12, 2100);
+    fillBoard(game, 12, 2100);
+    EXPECT_EQ(printSlice(game, GridPoint(0, 0), 12, 2100), printRegion(game, GridPoint(0, 0), 12, 2100));
+    EXPECT_EQ(printSlice(game, GridPoint(3, 5), 4, 7), printRegion(game, GridPoint(3, 5), 4, 7));
+    EXPECT_EQ(printSlice(game, GridPoint(11, 2099), 1, 1), printRegion(game, GridPoint(11, 2099), 1, 1));
+    EXPECT_EQ(printSlice(game, GridPoint(2, 1000), 10, 1100), printRegion(game, GridPoint(2, 1000), 10, 1100));
+    std::ostringstream os;
+    os << game;
+    EXPECT_EQ(printSlice(game, GridPoint(0, 0), 12, 2100), os.str());
+}
+
+TEST(BoardRegionTest, RegionsOutsideTheBoardAreRejected) {
+    Game game(6, 8);
+    fillBoard(game, 6, 8);
+    std::ostringstream os;
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(0, 0), 0, 1), IllegalArgument);
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(0, 0), 1, -1), IllegalArgument);
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(-1, 0), 1, 1), IllegalCell);
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(0, 8), 1, 1), IllegalCell);
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(0, 0), 7, 8), IllegalCell);
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(5, 7), 1, 2), IllegalCell);
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(2, 3), INT_MAX, 1), IllegalCell);
+    EXPECT_THROW(game.printBoardRegion(os, GridPoint(2, 3), 1, INT_MAX), IllegalCell);
+    EXPECT_TRUE(os.str().empty());
+}
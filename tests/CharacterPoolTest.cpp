@@ -0,0 +1,49 @@
+#include "CharacterPool.h"
+#include "Game.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    void makeWave(std::vector<std::shared_ptr<Character>>& wave) {
+        for (std::shared_ptr<Character>& character : wave)
+        {
+            character = Game::makeCharacter(SNIPER, CROSSFITTERS, 10, 5, 3, 2);
+        }
+    }
+}
+
+TEST(CharacterPoolTest, FreedCharactersAreReused) {
+    std::vector<std::shared_ptr<Character>> wave(1000);
+    makeWave(wave);
+    CharacterPool::resetThreadStatistics();
+    wave.assign(wave.size(), nullptr);
+    makeWave(wave);
+    std::shared_ptr<Character> clone = wave[0]->clone();
+    CharacterPool::Statistics statistics = CharacterPool::getThreadStatistics();
+    EXPECT_EQ(1001u, statistics.pool_allocations);
+    EXPECT_EQ(1000u, statistics.pool_deallocations);
+    EXPECT_EQ(0u, statistics.slab_allocations);
+    EXPECT_EQ(0u, statistics.fallback_allocations);
+}
+
+TEST(CharacterPoolTest, CharactersCanBeFreedByAnotherThread) {
+    std::vector<std::shared_ptr<Character>> wave(1000);
+    makeWave(wave);
+    std::thread([&wave]() {
+        std::vector<std::shared_ptr<Character>> other_wave(1000);
+        makeWave(other_wave);
+        wave.assign(wave.size(), nullptr);
+        EXPECT_EQ(1000u, CharacterPool::getThreadStatistics().pool_deallocations);
+    }).join();
+    makeWave(wave);
+    for (const std::shared_ptr<Character>& character : wave)
+    {
+        EXPECT_EQ(SNIPER, character->getCharacterType());
+        EXPECT_EQ(10, character->getCharacterHealthPoints());
+    }
+}
@@ -0,0 +1,109 @@
+#include "Game.h"
+#include "GameSnapshot.h"
+#include "Medic.h"
+#include "Sniper.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * a character class that is not built in. it does not count its strikes, and may claim any type.
+    */
+    class Decoy : public Character {
+    public:
+        Decoy(units_t health, Team team) : Character(health, 0, 1, 0, team, 1, 0, 0, 'D', 'd')
+        {}
+
+        Decoy(units_t health, Team team, CharacterType type) :
+                Character(health, 0, 1, 0, team, 1, 0, 0, 'D', 'd', type)
+        {}
+
+        std::shared_ptr<Character> clone() const override {
+            return std::make_shared<Decoy>(*this);
+        }
+
+        bool isTargetInStrikeRange(const GridPoint&, const GridPoint&) const override {
+            return false;
+        }
+
+        bool isStrikeLegal(const GridPoint&, const GridPoint&, const Character*) const override {
+            return false;
+        }
+
+        units_t performStrike(const GridPoint&, const GridPoint&, const GridPoint&, const Character*) override {
+            return 0;
+        }
+    };
+
+    std::vector<char> serialize(const Game& game) {
+        std::vector<char> data;
+        GameSnapshot::serialize(game, data);
+        return data;
+    }
+}
+
+TEST(CharacterTest, ExtensionClassesDefaultToNoStrikesCounter) {
+    Decoy decoy(5, POWERLIFTERS);
+    EXPECT_EQ(SOLDIER, decoy.getCharacterType());
+    decoy.setSuccessfulStrikesCounter(7);
+    EXPECT_EQ(0, decoy.getSuccessfulStrikesCounter());
+}
+
+TEST(CharacterTest, SniperCounterSurvivesSnapshotsAndUndo) {
+    Game game(10, 10);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 10, 6, 1));
+    game.addCharacter(GridPoint(0, 4), Game::makeCharacter(SOLDIER, CROSSFITTERS, 20, 1, 1, 1));
+    game.attack(GridPoint(0, 0), GridPoint(0, 4));
+    game.attack(GridPoint(0, 0), GridPoint(0, 4));
+    std::vector<char> before = serialize(game);
+    uint64_t hash_before = game.getPositionHash();
+    Game loaded = GameSnapshot::deserialize(before.data(), before.size());
+    EXPECT_EQ(before, serialize(loaded));
+    EXPECT_EQ(hash_before, loaded.getPositionHash());
+    game.setUndoEnabled(true);
+    game.attack(GridPoint(0, 0), GridPoint(0, 4));
+    EXPECT_NE(hash_before, game.getPositionHash());
+    EXPECT_TRUE(game.undo());
+    EXPECT_EQ(before, serialize(game));
+    EXPECT_EQ(hash_before, game.getPositionHash());
+}
+
+TEST(CharacterTest, ExtensionClassThatClaimsSniperTypeIsNotCastToSniper) {
+    Game game(10, 10);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 10, 6, 1));
+    game.addCharacter(GridPoint(0, 3), std::make_shared<Decoy>(5, CROSSFITTERS, SNIPER));
+    UnitStore units;
+    game.exportUnits(units);
+    ASSERT_EQ(2, units.getSize());
+    game.setUndoEnabled(true);
+    uint64_t hash_before = game.getPositionHash();
+    game.attack(GridPoint(0, 0), GridPoint(0, 3));
+    EXPECT_TRUE(game.undo());
+    EXPECT_EQ(hash_before, game.getPositionHash());
+    std::vector<char> data = serialize(game);
+    Game loaded = GameSnapshot::deserialize(data.data(), data.size());
+    EXPECT_EQ(hash_before, loaded.getPositionHash());
+}
+
+TEST(CharacterTest, SharedPointerTargetsGiveTheSameResultsAsBorrowedOnes) {
+    std::shared_ptr<Character> medic = Game::makeCharacter(MEDIC, POWERLIFTERS, 10, 10, 5, 3);
+    std::shared_ptr<Character> ally = Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 0, 5, 3);
+    std::shared_ptr<Character> enemy = Game::makeCharacter(SOLDIER, CROSSFITTERS, 10, 0, 5, 3);
+    std::shared_ptr<Character> empty;
+    GridPoint src(0, 0);
+    GridPoint dst(0, 2);
+    for (const std::shared_ptr<Character>& target : {ally, enemy, empty})
+    {
+        EXPECT_EQ(medic->isCharacterHasEnoughAmmo(target.get()), medic->isCharacterHasEnoughAmmo(target));
+        EXPECT_EQ(medic->isStrikeLegal(src, dst, target.get()), medic->isStrikeLegal(src, dst, target));
+    }
+    EXPECT_EQ(medic->performStrike(src, dst, dst, ally.get()), medic->performStrike(src, dst, dst, ally));
+    EXPECT_EQ(medic->performStrike(src, dst, dst, enemy.get()), medic->performStrike(src, dst, dst, enemy));
+    Medic& borrowed_medic = static_cast<Medic&>(*medic);
+    EXPECT_EQ(borrowed_medic.isStrikeLegal(src, dst, medic.get()), borrowed_medic.isStrikeLegal(src, dst, medic));
+    EXPECT_FALSE(medic->isStrikeLegal(src, dst, nullptr));
+}
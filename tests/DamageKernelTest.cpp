@@ -0,0 +1,70 @@
+#include "DamageKernel.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * fills the arrays with health points around 0 and damage values of both signs, so that every length has units
+    * that die, units that survive, units that are healed and units that were not alive before the pass.
+    */
+    void makeField(int num_of_units, std::vector<units_t>& health_points, std::vector<units_t>& damage) {
+        health_points.resize(num_of_units);
+        damage.resize(num_of_units);
+        for (int i = 0; i < num_of_units; i++)
+        {
+            health_points[i] = (i * 7) % 11 - 3;
+            damage[i] = (i * 5) % 9 - 2;
+        }
+    }
+}
+
+TEST(DamageKernelTest, UsesAKnownInstructionSet) {
+    std::string instruction_set = DamageKernel::getInstructionSet();
+    EXPECT_TRUE(instruction_set == "avx2" || instruction_set == "sse2" || instruction_set == "scalar");
+}
+
+TEST(DamageKernelTest, MatchesTheScalarPassForEveryLength) {
+    for (int num_of_units = 0; num_of_units <= 70; num_of_units++)
+    {
+        std::vector<units_t> health_points;
+        std::vector<units_t> damage;
+        makeField(num_of_units, health_points, damage);
+        std::vector<units_t> expected_health_points = health_points;
+        int expected_deaths = DamageKernel::applyDamageFieldScalar(expected_health_points.data(), damage.data(),
+                                                                    num_of_units);
+        int deaths = DamageKernel::applyDamageField(health_points.data(), damage.data(), num_of_units);
+        EXPECT_EQ(expected_deaths, deaths) << "length " << num_of_units;
+        EXPECT_EQ(expected_health_points, health_points) << "length " << num_of_units;
+    }
+}
+
+TEST(DamageKernelTest, ScalarPassCountsOnlyUnitsThatWereAlive) {
+    std::vector<units_t> health_points = {5, 5, 5, 0, -1, 3, 1};
+    std::vector<units_t> damage = {4, 5, 6, 1, -2, -1, 0};
+    int deaths = DamageKernel::applyDamageFieldScalar(health_points.data(), damage.data(),
+                                                      static_cast<int>(health_points.size()));
+    EXPECT_EQ(2, deaths);
+    EXPECT_EQ((std::vector<units_t>{1, 0, -1, -1, 1, 4, 1}), health_points);
+}
+
+TEST(DamageKernelTest, UnalignedRangesMatchTheScalarPass) {
+    std::vector<units_t> health_points;
+    std::vector<units_t> damage;
+    makeField(64, health_points, damage);
+    for (int first = 1; first < 8; first++)
+    {
+        std::vector<units_t> expected_health_points = health_points;
+        std::vector<units_t> actual_health_points = health_points;
+        int num_of_units = 64 - first - 3;
+        int expected_deaths = DamageKernel::applyDamageFieldScalar(expected_health_points.data() + first,
+                                                                    damage.data() + first, num_of_units);
+        int deaths = DamageKernel::applyDamageField(actual_health_points.data() + first, damage.data() + first,
+                                                    num_of_units);
+        EXPECT_EQ(expected_deaths, deaths) << "offset " << first;
+        EXPECT_EQ(expected_health_points, actual_health_points) << "offset " << first;
+    }
+}
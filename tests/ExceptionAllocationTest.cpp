@@ -0,0 +1,73 @@
+#include "Exceptions.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+/**
+* the global allocation functions are replaced by ones that count the allocations, which is why this test is a
+* program of its own.
+*/
+namespace
+{
+    std::atomic<long long> num_of_allocations(0);
+
+    template <class ExceptionType>
+    long long countAllocationsOfThrows(int num_of_throws) {
+        long long first_count = num_of_allocations.load();
+        for (int i = 0; i < num_of_throws; i++)
+        {
+            try
+            {
+                throw ExceptionType();
+            }
+            catch (const mtm::Exception& e)
+            {
+                EXPECT_NE(nullptr, std::strstr(e.what(), "A game related error has occurred: "));
+            }
+        }
+        return num_of_allocations.load() - first_count;
+    }
+}
+
+void* operator new(std::size_t size) {
+    num_of_allocations++;
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+TEST(ExceptionAllocationTest, ThrowingGameExceptionsDoesNotAllocate) {
+    const int num_of_throws = 1000;
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::IllegalArgument>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::IllegalCell>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::CellEmpty>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::MoveTooFar>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::CellOccupied>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::OutOfRange>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::OutOfAmmo>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::IllegalTarget>(num_of_throws));
+    EXPECT_EQ(0, countAllocationsOfThrows<mtm::InvalidSnapshot>(num_of_throws));
+}
+
+TEST(ExceptionAllocationTest, ErrorMessageConstructorAllocatesAndKeepsTheBaseMessage) {
+    long long first_count = num_of_allocations.load();
+    mtm::Exception exception(std::string("CustomError"));
+    EXPECT_LT(0, num_of_allocations.load() - first_count);
+    EXPECT_STREQ("A game related error has occurred: CustomError", exception.what());
+    mtm::Exception copy(exception);
+    EXPECT_STREQ("A game related error has occurred: CustomError", copy.what());
+    EXPECT_STREQ("A game related error has occurred: OutOfAmmo", mtm::OutOfAmmo().what());
+}
@@ -0,0 +1,152 @@
+#include "Game.h"
+#include "ActionJournal.h"
+#include "CharacterPool.h"
+#include "GameSnapshot.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    std::string print(const Game& game) {
+        std::ostringstream os;
+        os << game;
+        return os.str();
+    }
+
+    Game makeDuel() {
+        Game game(5, 5);
+        game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 2, 3, 2));
+        game.addCharacter(GridPoint(0, 2), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 2, 3, 2));
+        return game;
+    }
+
+    std::vector<char> serialize(const Game& game) {
+        std::vector<char> data;
+        GameSnapshot::serialize(game, data);
+        return data;
+    }
+
+    /**
+    * a game whose soldier at (0,0) and medic at (0,2) are in the same board tile, with a sniper in another tile.
+    */
+    Game makeSharedTileGame() {
+        Game game(40, 40);
+        game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 2, 3, 2));
+        game.addCharacter(GridPoint(0, 2), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 2, 3, 2));
+        game.addCharacter(GridPoint(39, 39), Game::makeCharacter(SNIPER, CROSSFITTERS, 10, 0, 6, 2));
+        return game;
+    }
+
+    void attackAndReload(Game& game) {
+        game.attack(GridPoint(0, 0), GridPoint(0, 2));
+        game.reload(GridPoint(39, 39));
+    }
+
+    void moveAndStrikeBack(Game& game) {
+        game.move(GridPoint(0, 2), GridPoint(1, 2));
+        game.attack(GridPoint(1, 2), GridPoint(0, 0));
+        game.reload(GridPoint(0, 0));
+    }
+
+    void expectSameGame(const Game& expected, const Game& game) {
+        EXPECT_EQ(serialize(expected), serialize(game));
+        EXPECT_EQ(print(expected), print(game));
+        EXPECT_EQ(expected.getPositionHash(), game.getPositionHash());
+    }
+}
+
+TEST(GameCopyTest, RejectedAttackDoesNotCopySharedTiles) {
+    Game game = makeDuel();
+    Game fork = game.fork();
+    CharacterPool::resetThreadStatistics();
+    EXPECT_EQ(ACTION_OUT_OF_RANGE, fork.tryAttack(GridPoint(0, 0), GridPoint(4, 4)));
+    EXPECT_EQ(ACTION_ILLEGAL_TARGET, fork.tryAttack(GridPoint(0, 2), GridPoint(0, 1)));
+    EXPECT_EQ(0u, CharacterPool::getThreadStatistics().pool_allocations);
+    EXPECT_EQ(ACTION_SUCCESS, fork.tryAttack(GridPoint(0, 0), GridPoint(0, 2)));
+    EXPECT_LT(0u, CharacterPool::getThreadStatistics().pool_allocations);
+}
+
+TEST(GameCopyTest, CopyAssignmentKeepsTheJournal) {
+    Game game(5, 5);
+    ActionJournal journal(game, 0);
+    game.setJournal(&journal);
+    game.addCharacter(GridPoint(4, 4), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 2, 3, 2));
+    Game other = makeDuel();
+    game = other;
+    game.move(GridPoint(0, 0), GridPoint(1, 0));
+    EXPECT_EQ(2u, journal.getNumOfActions());
+    EXPECT_EQ(print(game), print(journal.replay()));
+    other.move(GridPoint(0, 2), GridPoint(0, 3));
+    EXPECT_EQ(2u, journal.getNumOfActions());
+}
+
+TEST(GameCopyTest, MoveAssignmentKeepsTheJournalAndEmptiesTheSource) {
+    Game game(3, 3);
+    ActionJournal journal(game, 0);
+    game.setJournal(&journal);
+    Game other = makeDuel();
+    game = std::move(other);
+    game.reload(GridPoint(0, 0));
+    EXPECT_EQ(print(game), print(journal.replay()));
+    EXPECT_EQ(ACTION_ILLEGAL_CELL, other.tryReload(GridPoint(0, 0)));
+    EXPECT_FALSE(other.isOver());
+    std::vector<CellUpdate> updates;
+    EXPECT_FALSE(game.getBoardChanges(0, updates));
+}
+
+TEST(GameCopyTest, MoveConstructionTakesTheWholeGame) {
+    Game game(5, 5);
+    ActionJournal journal(game, 0);
+    game.setJournal(&journal);
+    game.addCharacter(GridPoint(1, 1), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 2, 3, 2));
+    game.setUndoEnabled(true);
+    game.move(GridPoint(1, 1), GridPoint(1, 2));
+    Game moved(std::move(game));
+    moved.reload(GridPoint(1, 2));
+    EXPECT_EQ(3u, journal.getNumOfActions());
+    EXPECT_EQ(print(moved), print(journal.replay()));
+    EXPECT_EQ(ACTION_ILLEGAL_CELL, game.tryReload(GridPoint(1, 1)));
+    EXPECT_FALSE(game.undo());
+    EXPECT_TRUE(moved.undo());
+    EXPECT_TRUE(moved.undo());
+}
+
+TEST(GameCopyTest, WritesToAForkAndItsGameAreIndependent) {
+    for (int fork_writes_first = 0; fork_writes_first < 2; fork_writes_first++)
+    {
+        Game game = makeSharedTileGame();
+        Game expected_game(game);
+        Game expected_fork(game);
+        Game fork = game.fork();
+        EXPECT_EQ(game.getCharacter(GridPoint(0, 0)), fork.getCharacter(GridPoint(0, 0)));
+        if (fork_writes_first)
+        {
+            moveAndStrikeBack(fork);
+            attackAndReload(game);
+        }
+        else
+        {
+            attackAndReload(game);
+            moveAndStrikeBack(fork);
+        }
+        attackAndReload(expected_game);
+        moveAndStrikeBack(expected_fork);
+        expectSameGame(expected_game, game);
+        expectSameGame(expected_fork, fork);
+        EXPECT_NE(game.getCharacter(GridPoint(0, 0)), fork.getCharacter(GridPoint(0, 0)));
+        EXPECT_EQ(1, game.getCharacter(GridPoint(0, 0))->getCharacterAmmo());
+        EXPECT_EQ(10, game.getCharacter(GridPoint(0, 0))->getCharacterHealthPoints());
+        EXPECT_EQ(5, fork.getCharacter(GridPoint(0, 0))->getCharacterAmmo());
+        EXPECT_EQ(8, fork.getCharacter(GridPoint(0, 0))->getCharacterHealthPoints());
+        EXPECT_EQ(8, game.getCharacter(GridPoint(0, 2))->getCharacterHealthPoints());
+        EXPECT_EQ(nullptr, fork.getCharacter(GridPoint(0, 2)));
+        EXPECT_EQ(nullptr, game.getCharacter(GridPoint(1, 2)));
+        EXPECT_EQ(2, game.getCharacter(GridPoint(39, 39))->getCharacterAmmo());
+        EXPECT_EQ(0, fork.getCharacter(GridPoint(39, 39))->getCharacterAmmo());
+    }
+}
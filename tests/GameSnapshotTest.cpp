@@ -0,0 +1,155 @@
+#include "GameSnapshot.h"
+#include "LittleEndian.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    std::vector<char> makeHeader(uint32_t height, uint32_t width, uint64_t num_of_characters) {
+        std::vector<char> data = {'R', 'P', 'G', 'S'};
+        LittleEndian::writeUint32(data, 1);
+        LittleEndian::writeUint32(data, height);
+        LittleEndian::writeUint32(data, width);
+        LittleEndian::writeUint64(data, num_of_characters);
+        return data;
+    }
+
+    std::string getTempPath(const std::string& name) {
+        return ::testing::TempDir() + "game_snapshot_test_" + name;
+    }
+
+    void writeFile(const std::string& path, const std::vector<char>& data) {
+        std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+        file.write(data.data(), data.size());
+    }
+
+    Game makeGame() {
+        Game game(9, 6);
+        game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+        game.addCharacter(GridPoint(4, 3), Game::makeCharacter(MEDIC, CROSSFITTERS, 7, 0, 3, 4));
+        game.addCharacter(GridPoint(5, 5), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+        game.addCharacter(GridPoint(8, 5), Game::makeCharacter(SNIPER, CROSSFITTERS, 3, 2, 4, 2));
+        game.attack(GridPoint(8, 5), GridPoint(5, 5));
+        return game;
+    }
+
+    std::string printBoard(const Game& game) {
+        std::ostringstream os;
+        os << game;
+        return os.str();
+    }
+}
+
+TEST(GameSnapshotTest, RestoresTheSavedBoard) {
+    Game game(7, 5);
+    game.addCharacter(GridPoint(0, 4), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+    game.addCharacter(GridPoint(6, 0), Game::makeCharacter(SNIPER, CROSSFITTERS, 3, 2, 4, 2));
+    std::vector<char> data;
+    GameSnapshot::serialize(game, data);
+    Game restored = GameSnapshot::deserialize(data.data(), data.size());
+    EXPECT_EQ(printBoard(game), printBoard(restored));
+    EXPECT_EQ(game.getPositionHash(), restored.getPositionHash());
+}
+
+TEST(GameSnapshotTest, RejectsOversizedBoards) {
+    std::vector<char> data = makeHeader(0x7FFFFFFF, 0x7FFFFFFF, 0);
+    EXPECT_THROW(GameSnapshot::deserialize(data.data(), data.size()), InvalidSnapshot);
+    data = makeHeader(0x7FFFFFFF, 1, 0);
+    EXPECT_THROW(GameSnapshot::deserialize(data.data(), data.size()), InvalidSnapshot);
+    data = makeHeader(1 << 16, 1 << 16, 0);
+    EXPECT_THROW(GameSnapshot::deserialize(data.data(), data.size()), InvalidSnapshot);
+    data = makeHeader(0x80000000u, 4, 0);
+    EXPECT_THROW(GameSnapshot::deserialize(data.data(), data.size()), InvalidSnapshot);
+}
+
+TEST(GameSnapshotTest, RejectsMoreRecordsThanCells) {
+    Game game(2, 2);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(MEDIC, POWERLIFTERS, 10, 5, 2, 1));
+    std::vector<char> record;
+    GameSnapshot::serialize(game, record);
+    record.erase(record.begin(), record.begin() + 24);
+    std::vector<char> data = makeHeader(1, 1, 2);
+    data.insert(data.end(), record.begin(), record.end());
+    data.insert(data.end(), record.begin(), record.end());
+    EXPECT_THROW(GameSnapshot::deserialize(data.data(), data.size()), InvalidSnapshot);
+}
+
+TEST(GameSnapshotTest, RestoresTheSavedFile) {
+    Game game = makeGame();
+    std::string path = getTempPath("round_trip");
+    GameSnapshot::saveToFile(game, path);
+    Game restored = GameSnapshot::loadFromFile(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(printBoard(game), printBoard(restored));
+    EXPECT_EQ(game.getPositionHash(), restored.getPositionHash());
+    const Character* sniper = restored.getCharacter(GridPoint(8, 5));
+    ASSERT_NE(nullptr, sniper);
+    EXPECT_EQ(1, sniper->getSuccessfulStrikesCounter());
+    EXPECT_EQ(1, sniper->getCharacterAmmo());
+    std::vector<char> saved;
+    std::vector<char> resaved;
+    GameSnapshot::serialize(game, saved);
+    GameSnapshot::serialize(restored, resaved);
+    EXPECT_EQ(saved, resaved);
+}
+
+TEST(GameSnapshotTest, RejectsTruncatedFiles) {
+    std::vector<char> data;
+    GameSnapshot::serialize(makeGame(), data);
+    std::string path = getTempPath("truncated");
+    const size_t sizes[] = {0, 3, 23, 24, 25, 53, 54, data.size() - 1};
+    for (size_t size : sizes)
+    {
+        writeFile(path, std::vector<char>(data.begin(), data.begin() + size));
+        EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot) << "size " << size;
+    }
+    std::vector<char> extended = data;
+    extended.push_back(0);
+    writeFile(path, extended);
+    EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot);
+    std::remove(path.c_str());
+    EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot);
+}
+
+TEST(GameSnapshotTest, RejectsCorruptHeaders) {
+    std::vector<char> data;
+    GameSnapshot::serialize(makeGame(), data);
+    std::string path = getTempPath("corrupt_header");
+    const size_t corrupt_bytes[] = {0, 3, 4, 7, 11, 15, 16, 23};
+    for (size_t byte : corrupt_bytes)
+    {
+        std::vector<char> corrupt = data;
+        corrupt[byte] = static_cast<char>(corrupt[byte] ^ 0x80);
+        writeFile(path, corrupt);
+        EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot) << "byte " << byte;
+    }
+    std::vector<char> records(data.begin() + 24, data.end());
+    std::vector<char> no_height = makeHeader(0, 6, 4);
+    no_height.insert(no_height.end(), records.begin(), records.end());
+    writeFile(path, no_height);
+    EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot);
+    std::vector<char> short_board = makeHeader(8, 6, 4);
+    short_board.insert(short_board.end(), records.begin(), records.end());
+    writeFile(path, short_board);
+    EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot);
+    std::remove(path.c_str());
+}
+
+TEST(GameSnapshotTest, RejectsBoardsAboveTheLimits) {
+    std::string path = getTempPath("oversized");
+    writeFile(path, makeHeader((1 << 16) + 1, 1, 0));
+    EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot);
+    writeFile(path, makeHeader(1, (1 << 16) + 1, 0));
+    EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot);
+    writeFile(path, makeHeader(1 << 15, (1 << 15) + 1, 0));
+    EXPECT_THROW(GameSnapshot::loadFromFile(path), InvalidSnapshot);
+    writeFile(path, makeHeader(1 << 16, 4, 0));
+    EXPECT_NO_THROW(GameSnapshot::loadFromFile(path));
+    std::remove(path.c_str());
+}
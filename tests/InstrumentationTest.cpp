@@ -0,0 +1,56 @@
+#include "Game.h"
+#include "Instrumentation.h"
+#include <gtest/gtest.h>
+#include <utility>
+
+using namespace mtm;
+
+namespace
+{
+    Game makeBoard() {
+        Game game(32, 32);
+        for (int r = 0; r < 32; r += 2)
+        {
+            game.addCharacter(GridPoint(r, r), Game::makeCharacter(SOLDIER, static_cast<Team>(r % 4 / 2), 10, 2, 3, 2));
+        }
+        return game;
+    }
+
+    unsigned long long getCopies() {
+        InstrumentationSnapshot snapshot;
+        Instrumentation::getSnapshot(snapshot);
+        return snapshot.calls[COPY_OPERATION];
+    }
+}
+
+TEST(InstrumentationTest, CopiesAreCountedAndForksAreNot) {
+    if (!Instrumentation::isCompiledIn())
+    {
+        GTEST_SKIP();
+    }
+    Game game = makeBoard();
+    Instrumentation::reset();
+    Game copy(game);
+    EXPECT_EQ(1u, getCopies());
+    Game assigned(2, 2);
+    assigned = game;
+    EXPECT_EQ(2u, getCopies());
+    Game fork = game.fork();
+    Game moved(std::move(copy));
+    EXPECT_EQ(2u, getCopies());
+    InstrumentationSnapshot snapshot;
+    Instrumentation::getSnapshot(snapshot);
+    EXPECT_LT(0u, snapshot.total_nanoseconds[COPY_OPERATION]);
+}
+
+TEST(InstrumentationTest, NothingIsCountedWhenTheHooksAreCompiledOut) {
+    if (Instrumentation::isCompiledIn())
+    {
+        GTEST_SKIP();
+    }
+    Instrumentation::reset();
+    Game game = makeBoard();
+    Game copy(game);
+    copy.reload(GridPoint(0, 0));
+    EXPECT_EQ(0u, getCopies());
+}
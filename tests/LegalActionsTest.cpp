@@ -0,0 +1,214 @@
+#include "Game.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * lists the cells of the board a move from the given coordinates succeeds to, by trying the move to every cell
+    * of the board on a copy of the game, in row-major order.
+    */
+    std::vector<GridPoint> acceptedMoves(const Game& game, const GridPoint& coordinates, int height, int width) {
+        std::vector<GridPoint> destinations;
+        for (int r = 0; r < height; r++)
+        {
+            for (int c = 0; c < width; c++)
+            {
+                Game copy(game);
+                if (copy.tryMove(coordinates, GridPoint(r, c)) == ACTION_SUCCESS)
+                {
+                    destinations.push_back(GridPoint(r, c));
+                }
+            }
+        }
+        return destinations;
+    }
+
+    /**
+    * lists the cells of the board an attack from the given coordinates succeeds on, by trying the attack on every
+    * cell of the board on a copy of the game, in row-major order.
+    */
+    std::vector<GridPoint> acceptedTargets(const Game& game, const GridPoint& coordinates, int height, int width) {
+        std::vector<GridPoint> targets;
+        for (int r = 0; r < height; r++)
+        {
+            for (int c = 0; c < width; c++)
+            {
+                Game copy(game);
+                if (copy.tryAttack(coordinates, GridPoint(r, c)) == ACTION_SUCCESS)
+                {
+                    targets.push_back(GridPoint(r, c));
+                }
+            }
+        }
+        return targets;
+    }
+
+    /**
+    * fills a 9x9 board with units of both teams at scattered cells around the center, which is left empty for the
+    * attacker of a test.
+    */
+    Game makeCrowdedBoard() {
+        Game game(9, 9);
+        for (int r = 0; r < 9; r++)
+        {
+            for (int c = 0; c < 9; c++)
+            {
+                if ((r * 5 + c * 3) % 4 == 0 && !(r == 4 && c == 4))
+                {
+                    Team team = ((r + c) % 3 == 0) ? POWERLIFTERS : CROSSFITTERS;
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(SOLDIER, team, 10, 5, 2, 1));
+                }
+            }
+        }
+        return game;
+    }
+
+    void expectTargetsMatchAttacks(const Game& game, const GridPoint& coordinates) {
+        std::vector<GridPoint> targets;
+        ASSERT_EQ(ACTION_SUCCESS, game.legalTargets(coordinates, targets));
+        EXPECT_EQ(acceptedTargets(game, coordinates, 9, 9), targets);
+    }
+}
+
+TEST(LegalActionsTest, MovesAreClippedAtTheEdgesOfTheBoard) {
+    Game game(8, 8);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+    game.addCharacter(GridPoint(7, 6), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 2, 1));
+    std::vector<GridPoint> destinations;
+    ASSERT_EQ(ACTION_SUCCESS, game.legalMoves(GridPoint(0, 0), destinations));
+    EXPECT_EQ(9u, destinations.size());
+    EXPECT_EQ(acceptedMoves(game, GridPoint(0, 0), 8, 8), destinations);
+    ASSERT_EQ(ACTION_SUCCESS, game.legalMoves(GridPoint(7, 6), destinations));
+    EXPECT_EQ(acceptedMoves(game, GridPoint(7, 6), 8, 8), destinations);
+    for (const GridPoint& destination : destinations)
+    {
+        EXPECT_LE(GridPoint::distance(GridPoint(7, 6), destination), 5);
+    }
+}
+
+TEST(LegalActionsTest, OccupiedCellsAreNotMoves) {
+    Game game(6, 6);
+    game.addCharacter(GridPoint(2, 2), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 5, 2, 1));
+    game.addCharacter(GridPoint(2, 3), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+    game.addCharacter(GridPoint(0, 2), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 2, 1));
+    game.addCharacter(GridPoint(5, 5), Game::makeCharacter(SOLDIER, CROSSFITTERS, 10, 5, 2, 1));
+    std::vector<GridPoint> destinations;
+    ASSERT_EQ(ACTION_SUCCESS, game.legalMoves(GridPoint(2, 2), destinations));
+    EXPECT_EQ(acceptedMoves(game, GridPoint(2, 2), 6, 6), destinations);
+    for (const GridPoint& destination : destinations)
+    {
+        EXPECT_EQ(nullptr, game.getCharacter(destination));
+    }
+    EXPECT_FALSE(destinations.empty());
+}
+
+TEST(LegalActionsTest, BlockedUnitHasNoMoves) {
+    Game game(3, 3);
+    for (int r = 0; r < 3; r++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            game.addCharacter(GridPoint(r, c), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 2, 1));
+        }
+    }
+    std::vector<GridPoint> destinations(1, GridPoint(0, 0));
+    EXPECT_EQ(ACTION_SUCCESS, game.legalMoves(GridPoint(1, 1), destinations));
+    EXPECT_TRUE(destinations.empty());
+    Game single_cell(1, 1);
+    single_cell.addCharacter(GridPoint(0, 0), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 2, 1));
+    destinations.assign(1, GridPoint(0, 0));
+    EXPECT_EQ(ACTION_SUCCESS, single_cell.legalMoves(GridPoint(0, 0), destinations));
+    EXPECT_TRUE(destinations.empty());
+}
+
+TEST(LegalActionsTest, MovesOfMissingUnitsAreRejected) {
+    Game game(4, 4);
+    std::vector<GridPoint> destinations(1, GridPoint(0, 0));
+    EXPECT_EQ(ACTION_ILLEGAL_CELL, game.legalMoves(GridPoint(4, 0), destinations));
+    EXPECT_TRUE(destinations.empty());
+    destinations.assign(1, GridPoint(0, 0));
+    EXPECT_EQ(ACTION_CELL_EMPTY, game.legalMoves(GridPoint(1, 1), destinations));
+    EXPECT_TRUE(destinations.empty());
+}
+
+TEST(LegalActionsTest, SoldierTargetsAreTheAttacksOnItsRowAndColumn) {
+    Game game = makeCrowdedBoard();
+    game.addCharacter(GridPoint(4, 4), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 3, 1));
+    expectTargetsMatchAttacks(game, GridPoint(4, 4));
+    std::vector<GridPoint> targets;
+    game.legalTargets(GridPoint(4, 4), targets);
+    EXPECT_EQ(13u, targets.size());
+    for (const GridPoint& target : targets)
+    {
+        EXPECT_TRUE(target.row == 4 || target.col == 4);
+    }
+    Game edge = makeCrowdedBoard();
+    edge.addCharacter(GridPoint(8, 7), Game::makeCharacter(SOLDIER, CROSSFITTERS, 10, 5, 20, 1));
+    expectTargetsMatchAttacks(edge, GridPoint(8, 7));
+    Game unloaded = makeCrowdedBoard();
+    unloaded.addCharacter(GridPoint(4, 4), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 0, 3, 1));
+    ASSERT_EQ(ACTION_SUCCESS, unloaded.legalTargets(GridPoint(4, 4), targets));
+    EXPECT_TRUE(targets.empty());
+    expectTargetsMatchAttacks(unloaded, GridPoint(4, 4));
+}
+
+TEST(LegalActionsTest, SniperTargetsAreTheEnemiesInItsRing) {
+    for (units_t range = 1; range <= 8; range++)
+    {
+        Game game = makeCrowdedBoard();
+        game.addCharacter(GridPoint(4, 4), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 5, range, 1));
+        expectTargetsMatchAttacks(game, GridPoint(4, 4));
+        std::vector<GridPoint> targets;
+        game.legalTargets(GridPoint(4, 4), targets);
+        for (const GridPoint& target : targets)
+        {
+            int distance = GridPoint::distance(GridPoint(4, 4), target);
+            EXPECT_LE(distance, range);
+            EXPECT_GE(2 * distance, range);
+            ASSERT_NE(nullptr, game.getCharacter(target));
+            EXPECT_EQ(CROSSFITTERS, game.getCharacter(target)->getCharacterTeam());
+        }
+    }
+}
+
+TEST(LegalActionsTest, MedicTargetsAreTheOtherUnitsInRange) {
+    Game game = makeCrowdedBoard();
+    game.addCharacter(GridPoint(4, 4), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 5, 3, 1));
+    expectTargetsMatchAttacks(game, GridPoint(4, 4));
+    std::vector<GridPoint> targets;
+    game.legalTargets(GridPoint(4, 4), targets);
+    bool has_ally = false;
+    bool has_enemy = false;
+    for (const GridPoint& target : targets)
+    {
+        EXPECT_FALSE(target == GridPoint(4, 4));
+        ASSERT_NE(nullptr, game.getCharacter(target));
+        bool is_ally = (game.getCharacter(target)->getCharacterTeam() == CROSSFITTERS);
+        has_ally = has_ally || is_ally;
+        has_enemy = has_enemy || !is_ally;
+    }
+    EXPECT_TRUE(has_ally);
+    EXPECT_TRUE(has_enemy);
+    Game unloaded = makeCrowdedBoard();
+    unloaded.addCharacter(GridPoint(4, 4), Game::makeCharacter(MEDIC, CROSSFITTERS, 10, 0, 3, 1));
+    expectTargetsMatchAttacks(unloaded, GridPoint(4, 4));
+    unloaded.legalTargets(GridPoint(4, 4), targets);
+    EXPECT_FALSE(targets.empty());
+    for (const GridPoint& target : targets)
+    {
+        EXPECT_EQ(CROSSFITTERS, unloaded.getCharacter(target)->getCharacterTeam());
+    }
+}
+
+TEST(LegalActionsTest, TargetsOfMissingUnitsAreRejected) {
+    Game game(4, 4);
+    std::vector<GridPoint> targets(1, GridPoint(0, 0));
+    EXPECT_EQ(ACTION_ILLEGAL_CELL, game.legalTargets(GridPoint(0, 4), targets));
+    EXPECT_TRUE(targets.empty());
+    targets.assign(1, GridPoint(0, 0));
+    EXPECT_EQ(ACTION_CELL_EMPTY, game.legalTargets(GridPoint(1, 1), targets));
+    EXPECT_TRUE(targets.empty());
+}
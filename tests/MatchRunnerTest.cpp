@@ -0,0 +1,68 @@
+#include "MatchRunner.h"
+#include "RandomPolicy.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    Game makeBoard(unsigned int seed) {
+        Game game(12, 12);
+        std::mt19937 generator(seed);
+        for (int r = 0; r < 12; r++)
+        {
+            for (int c = 0; c < 12; c++)
+            {
+                if (generator() % 4 == 0)
+                {
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(
+                            static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                            4, 2, 4, 2));
+                }
+            }
+        }
+        return game;
+    }
+
+    std::vector<MatchResult> runMatches(const Game& board, int num_of_threads) {
+        MatchRunner runner(num_of_threads);
+        std::vector<MatchResult> results;
+        runner.run(64, [&board](int) { return board.fork(); },
+                   [](int match_index, Team team) -> std::unique_ptr<TeamPolicy> {
+                       return std::unique_ptr<TeamPolicy>(new RandomPolicy(match_index * 2 + team));
+                   }, 4000, results);
+        return results;
+    }
+}
+
+TEST(MatchRunnerTest, ResultsDoNotDependOnTheNumberOfThreads) {
+    Game board = makeBoard(7);
+    std::vector<MatchResult> serial_results = runMatches(board, 1);
+    std::vector<MatchResult> parallel_results = runMatches(board, 4);
+    ASSERT_EQ(serial_results.size(), parallel_results.size());
+    int num_of_finished_matches = 0;
+    for (size_t i = 0; i < serial_results.size(); i++)
+    {
+        EXPECT_EQ(static_cast<int>(i), parallel_results[i].match_index);
+        EXPECT_EQ(serial_results[i].is_over, parallel_results[i].is_over);
+        EXPECT_EQ(serial_results[i].num_of_turns, parallel_results[i].num_of_turns);
+        if (serial_results[i].is_over)
+        {
+            EXPECT_EQ(serial_results[i].winning_team, parallel_results[i].winning_team);
+            num_of_finished_matches++;
+        }
+    }
+    EXPECT_LT(0, num_of_finished_matches);
+}
+
+TEST(MatchRunnerTest, ConcurrentForksLeaveTheSharedBoardUnchanged) {
+    Game board = makeBoard(11);
+    Game copy(board);
+    uint64_t hash = board.getPositionHash();
+    runMatches(board, 4);
+    EXPECT_EQ(hash, board.getPositionHash());
+    EXPECT_EQ(copy.getPositionHash(), board.getPositionHash());
+}
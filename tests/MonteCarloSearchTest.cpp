@@ -0,0 +1,67 @@
+#include "MonteCarloSearch.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+
+using namespace mtm;
+
+namespace
+{
+    Game makeBoard(unsigned int seed) {
+        Game game(12, 12);
+        std::mt19937 generator(seed);
+        for (int r = 0; r < 12; r++)
+        {
+            for (int c = 0; c < 12; c++)
+            {
+                if (generator() % 6 == 0)
+                {
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(
+                            static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                            8, 3, 5, 3));
+                }
+            }
+        }
+        return game;
+    }
+
+    std::string print(const Game& game) {
+        std::ostringstream os;
+        os << game;
+        return os.str();
+    }
+}
+
+TEST(MonteCarloSearchTest, SameSeedChoosesTheSameLegalAction) {
+    Game game = makeBoard(1);
+    std::string before = print(game);
+    for (int num_of_threads : {1, 3})
+    {
+        Action first(RELOAD_ACTION, GridPoint(0, 0), GridPoint(0, 0));
+        Action second = first;
+        MonteCarloSearch first_search(num_of_threads, 30, 7);
+        MonteCarloSearch second_search(num_of_threads, 30, 7);
+        ASSERT_TRUE(first_search.search(game, POWERLIFTERS, 100, first));
+        ASSERT_TRUE(second_search.search(game, POWERLIFTERS, 100, second));
+        EXPECT_EQ(first.type, second.type);
+        EXPECT_EQ(first.src_coordinates, second.src_coordinates);
+        EXPECT_EQ(first.dst_coordinates, second.dst_coordinates);
+        EXPECT_LT(0, first_search.getRolloutsPerSecond());
+        Game played = game.fork();
+        EXPECT_EQ(ACTION_SUCCESS, played.tryAction(first));
+    }
+    EXPECT_EQ(before, print(game));
+}
+
+TEST(MonteCarloSearchTest, EveryChosenActionOfAMatchIsLegal) {
+    Game game = makeBoard(5);
+    MonteCarloSearch search(2, 20, 3);
+    Team team = POWERLIFTERS;
+    for (int turn = 0; turn < 60 && !game.isOver(); turn++)
+    {
+        Action action(RELOAD_ACTION, GridPoint(0, 0), GridPoint(0, 0));
+        ASSERT_TRUE(search.search(game, team, 50, action));
+        EXPECT_EQ(ACTION_SUCCESS, game.tryAction(action));
+        team = team == POWERLIFTERS ? CROSSFITTERS : POWERLIFTERS;
+    }
+}
@@ -0,0 +1,58 @@
+#include "Simulation.h"
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace mtm;
+
+namespace
+{
+    SimulationConfig makeSmallConfig() {
+        SimulationConfig config;
+        config.height = 16;
+        config.width = 16;
+        config.num_of_matches = 4;
+        config.max_turns = 200;
+        config.num_of_threads = 2;
+        config.num_of_copies = 1;
+        config.num_of_renders = 1;
+        return config;
+    }
+}
+
+TEST(SimulationTest, SameSeedGeneratesSameBoard) {
+    Simulation simulation(makeSmallConfig());
+    std::ostringstream first;
+    std::ostringstream second;
+    first << simulation.generateBoard();
+    second << simulation.generateBoard();
+    EXPECT_EQ(first.str(), second.str());
+}
+
+TEST(SimulationTest, RandomMatchesAreReproducible) {
+    Simulation simulation(makeSmallConfig());
+    SimulationReport first = simulation.run();
+    SimulationReport second = simulation.run();
+    EXPECT_EQ(first.num_of_turns, second.num_of_turns);
+    EXPECT_EQ(first.num_of_actions, second.num_of_actions);
+    EXPECT_EQ(first.num_of_attacks, second.num_of_attacks);
+    EXPECT_EQ(first.num_of_finished_matches, second.num_of_finished_matches);
+    EXPECT_GT(first.num_of_actions, 0);
+}
+
+TEST(SimulationTest, InvalidConfigThrows) {
+    SimulationConfig config = makeSmallConfig();
+    config.density = 1.5;
+    EXPECT_THROW(Simulation simulation(config), IllegalArgument);
+    config = makeSmallConfig();
+    config.soldier_weight = 0;
+    config.medic_weight = 0;
+    config.sniper_weight = 0;
+    EXPECT_THROW(Simulation simulation(config), IllegalArgument);
+}
+
+TEST(SimulationTest, CliRejectsUnknownOptions) {
+    const char* const argv[] = {"rpg_sim", "--colour", "red"};
+    std::ostringstream output;
+    EXPECT_EQ(1, Simulation::runCli(3, argv, output));
+    EXPECT_NE(std::string::npos, output.str().find("invalid option: --colour"));
+}
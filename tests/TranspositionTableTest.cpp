@@ -0,0 +1,158 @@
+#include "TranspositionTable.h"
+#include "Exceptions.h"
+#include "Game.h"
+#include "GameSnapshot.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    /**
+    * the entry every test stores for a hash, so a probe can check that it got the entry of the hash it asked for.
+    */
+    TranspositionEntry makeEntry(uint64_t hash) {
+        TranspositionEntry entry = {static_cast<int32_t>(hash >> 32), static_cast<int32_t>(hash % 64) - 32};
+        return entry;
+    }
+}
+
+TEST(TranspositionTableTest, SlotsAreRoundedUpToAPowerOfTwo) {
+    EXPECT_EQ(1u, TranspositionTable(1).getNumOfSlots());
+    EXPECT_EQ(8u, TranspositionTable(5).getNumOfSlots());
+    EXPECT_EQ(1024u, TranspositionTable(1024).getNumOfSlots());
+    EXPECT_THROW(TranspositionTable(0), IllegalArgument);
+}
+
+TEST(TranspositionTableTest, StoredEntriesAreFound) {
+    TranspositionTable table(1024);
+    std::mt19937_64 generator(3);
+    std::vector<uint64_t> hashes;
+    for (uint64_t i = 0; i < 1024; i++)
+    {
+        hashes.push_back((generator() & ~static_cast<uint64_t>(1023)) | i);
+    }
+    TranspositionEntry entry = {0, 0};
+    EXPECT_FALSE(table.probe(hashes[0], entry));
+    for (uint64_t hash : hashes)
+    {
+        table.store(hash, makeEntry(hash));
+    }
+    for (uint64_t hash : hashes)
+    {
+        ASSERT_TRUE(table.probe(hash, entry));
+        EXPECT_EQ(makeEntry(hash).value, entry.value);
+        EXPECT_EQ(makeEntry(hash).depth, entry.depth);
+    }
+    table.clear();
+    EXPECT_FALSE(table.probe(hashes[0], entry));
+    EXPECT_FALSE(table.probe(0, entry));
+}
+
+TEST(TranspositionTableTest, CollidingStoresReplaceTheSlot) {
+    TranspositionTable table(8);
+    uint64_t first = 0x1234567800000003;
+    uint64_t second = first + 8;
+    TranspositionEntry entry = {0, 0};
+    table.store(first, {10, 5});
+    table.store(second, {20, 1});
+    EXPECT_FALSE(table.probe(first, entry));
+    ASSERT_TRUE(table.probe(second, entry));
+    EXPECT_EQ(20, entry.value);
+    table.store(second, {30, 0});
+    ASSERT_TRUE(table.probe(second, entry));
+    EXPECT_EQ(20, entry.value);
+    EXPECT_EQ(1, entry.depth);
+    table.store(second, {40, 1});
+    ASSERT_TRUE(table.probe(second, entry));
+    EXPECT_EQ(40, entry.value);
+    table.store(first, {-7, -1});
+    ASSERT_TRUE(table.probe(first, entry));
+    EXPECT_EQ(-7, entry.value);
+    EXPECT_EQ(-1, entry.depth);
+}
+
+TEST(TranspositionTableTest, ProbesOfOtherKeysInTheSlotMiss) {
+    TranspositionTable table(16);
+    uint64_t hash = 0x0F0F0F0F0F0F0F05;
+    table.store(hash, {7, 2});
+    TranspositionEntry entry = {0, 0};
+    for (int bit = 4; bit < 64; bit++)
+    {
+        EXPECT_FALSE(table.probe(hash ^ (static_cast<uint64_t>(1) << bit), entry)) << "bit " << bit;
+    }
+    EXPECT_TRUE(table.probe(hash, entry));
+}
+
+TEST(TranspositionTableTest, ConcurrentProbesOnlyFindTheEntriesOfTheirHash) {
+    TranspositionTable table(64);
+    std::atomic<int> num_of_wrong_entries(0);
+    std::atomic<int> num_of_hits(0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < 4; t++)
+    {
+        threads.push_back(std::thread([&table, &num_of_wrong_entries, &num_of_hits, t]() {
+            std::mt19937_64 generator(t % 2);
+            std::vector<uint64_t> hashes(256);
+            for (uint64_t& hash : hashes)
+            {
+                hash = generator();
+            }
+            for (int i = 0; i < 20000; i++)
+            {
+                uint64_t hash = hashes[(i * 7 + t) % hashes.size()];
+                TranspositionEntry entry = {0, 0};
+                if (table.probe(hash, entry))
+                {
+                    num_of_hits++;
+                    if (entry.value != makeEntry(hash).value || entry.depth != makeEntry(hash).depth)
+                    {
+                        num_of_wrong_entries++;
+                    }
+                }
+                table.store(hash, makeEntry(hash));
+            }
+        }));
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(0, num_of_wrong_entries.load());
+    EXPECT_LT(0, num_of_hits.load());
+}
+
+TEST(TranspositionTableTest, EntriesOfAPositionAreFoundAfterUndo) {
+    Game game(6, 6);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 5, 3, 2));
+    game.addCharacter(GridPoint(0, 2), Game::makeCharacter(MEDIC, CROSSFITTERS, 2, 1, 2, 1));
+    game.addCharacter(GridPoint(3, 3), Game::makeCharacter(SNIPER, CROSSFITTERS, 8, 2, 4, 3));
+    game.setUndoEnabled(true);
+    TranspositionTable table(256);
+    uint64_t hash_before = game.getPositionHash();
+    table.store(hash_before, {11, 3});
+    const Action actions[] = {Action(MOVE_ACTION, GridPoint(3, 3), GridPoint(4, 4)),
+                              Action(ATTACK_ACTION, GridPoint(0, 0), GridPoint(0, 2)),
+                              Action(RELOAD_ACTION, GridPoint(0, 0), GridPoint(0, 0))};
+    for (const Action& action : actions)
+    {
+        ASSERT_EQ(ACTION_SUCCESS, game.tryAction(action));
+        EXPECT_NE(hash_before, game.getPositionHash());
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(game.undo());
+    }
+    EXPECT_EQ(hash_before, game.getPositionHash());
+    std::vector<char> data;
+    GameSnapshot::serialize(game, data);
+    EXPECT_EQ(hash_before, GameSnapshot::deserialize(data.data(), data.size()).getPositionHash());
+    TranspositionEntry entry = {0, 0};
+    ASSERT_TRUE(table.probe(game.getPositionHash(), entry));
+    EXPECT_EQ(11, entry.value);
+    EXPECT_EQ(3, entry.depth);
+}
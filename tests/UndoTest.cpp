@@ -0,0 +1,122 @@
+#include "Game.h"
+#include "CharacterPool.h"
+#include "GameSnapshot.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    std::vector<char> serialize(const Game& game) {
+        std::vector<char> data;
+        GameSnapshot::serialize(game, data);
+        return data;
+    }
+
+    std::string print(const Game& game) {
+        std::ostringstream os;
+        os << game;
+        return os.str();
+    }
+
+    Game makeBoard(std::mt19937& generator, int height, int width) {
+        Game game(height, width);
+        for (int i = 0; i < height * width / 2; i++)
+        {
+            GridPoint coordinates(generator() % height, generator() % width);
+            try
+            {
+                game.addCharacter(coordinates, Game::makeCharacter(
+                        static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                        1 + generator() % 6, generator() % 4, 1 + generator() % 8, 1 + generator() % 4));
+            }
+            catch (const CellOccupied&)
+            {
+            }
+        }
+        return game;
+    }
+
+    /**
+    * performs random actions depth first, and checks that undoing every successful one restores the game.
+    */
+    void searchAndUndo(Game& game, std::mt19937& generator, int height, int width, int depth) {
+        if (depth == 0)
+        {
+            return;
+        }
+        std::vector<char> before = serialize(game);
+        std::string printed_before = print(game);
+        uint64_t hash_before = game.getPositionHash();
+        for (int i = 0; i < 3; i++)
+        {
+            GridPoint src(generator() % height, generator() % width);
+            GridPoint dst(generator() % 2 ? src.row : generator() % height, generator() % width);
+            ActionType type = static_cast<ActionType>(generator() % 3);
+            if (game.tryAction(Action(type, src, dst)) != ACTION_SUCCESS)
+            {
+                EXPECT_EQ(before, serialize(game));
+                continue;
+            }
+            searchAndUndo(game, generator, height, width, depth - 1);
+            ASSERT_TRUE(game.undo());
+            EXPECT_EQ(before, serialize(game));
+            EXPECT_EQ(printed_before, print(game));
+            EXPECT_EQ(hash_before, game.getPositionHash());
+        }
+    }
+}
+
+TEST(UndoTest, UndoRestoresEveryActionOfADepthFirstSearch) {
+    for (unsigned int seed = 0; seed < 20; seed++)
+    {
+        std::mt19937 generator(seed);
+        int height = 2 + generator() % 12;
+        int width = 2 + generator() % 12;
+        Game game = makeBoard(generator, height, width);
+        EXPECT_FALSE(game.undo());
+        game.setUndoEnabled(true);
+        EXPECT_FALSE(game.undo());
+        searchAndUndo(game, generator, height, width, 5);
+        EXPECT_FALSE(game.undo());
+    }
+}
+
+TEST(UndoTest, UndoRestoresKilledUnitsWithoutAllocating) {
+    Game game(1, 3);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 10, 3, 20));
+    game.addCharacter(GridPoint(0, 2), Game::makeCharacter(SOLDIER, CROSSFITTERS, 5, 1, 1, 1));
+    game.setUndoEnabled(true);
+    std::vector<char> before = serialize(game);
+    game.attack(GridPoint(0, 0), GridPoint(0, 2));
+    ASSERT_TRUE(game.undo());
+    CharacterPool::resetThreadStatistics();
+    for (int i = 0; i < 100; i++)
+    {
+        game.attack(GridPoint(0, 0), GridPoint(0, 2));
+        Team winning_team = CROSSFITTERS;
+        EXPECT_TRUE(game.isOver(&winning_team));
+        EXPECT_EQ(POWERLIFTERS, winning_team);
+        ASSERT_TRUE(game.undo());
+    }
+    EXPECT_EQ(0u, CharacterPool::getThreadStatistics().pool_allocations);
+    EXPECT_EQ(before, serialize(game));
+    EXPECT_FALSE(game.isOver());
+}
+
+TEST(UndoTest, CopiesStartWithNoUndoRecordsAndDisablingDiscardsThem) {
+    Game game(3, 3);
+    game.setUndoEnabled(true);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SOLDIER, POWERLIFTERS, 10, 2, 3, 2));
+    game.move(GridPoint(0, 0), GridPoint(1, 0));
+    Game copy(game);
+    Game fork = game.fork();
+    EXPECT_FALSE(copy.undo());
+    EXPECT_FALSE(fork.undo());
+    game.setUndoEnabled(false);
+    EXPECT_FALSE(game.undo());
+}
@@ -0,0 +1,151 @@
+#include "UnitStore.h"
+#include "Game.h"
+#include "GameSnapshot.h"
+#include "Medic.h"
+#include "Exceptions.h"
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    std::vector<char> serialize(const Game& game) {
+        std::vector<char> data;
+        GameSnapshot::serialize(game, data);
+        return data;
+    }
+
+    Game makeBoard(unsigned int seed, int height, int width) {
+        std::mt19937 generator(seed);
+        Game game(height, width);
+        for (int r = 0; r < height; r++)
+        {
+            for (int c = 0; c < width; c++)
+            {
+                if (generator() % 3 == 0)
+                {
+                    game.addCharacter(GridPoint(r, c), Game::makeCharacter(
+                            static_cast<CharacterType>(generator() % 3), static_cast<Team>(generator() % 2),
+                            1 + generator() % 20, generator() % 6, 1 + generator() % 8, 1 + generator() % 5));
+                }
+            }
+        }
+        return game;
+    }
+}
+
+TEST(UnitStoreTest, UnitsRoundTripToTheCharactersOfTheGame) {
+    Game game(6, 6);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(SNIPER, POWERLIFTERS, 10, 5, 4, 2));
+    game.addCharacter(GridPoint(0, 3), Game::makeCharacter(SOLDIER, CROSSFITTERS, 9, 1, 2, 1));
+    game.addCharacter(GridPoint(2, 5), Game::makeCharacter(MEDIC, CROSSFITTERS, 4, 0, 3, 2));
+    game.addCharacter(GridPoint(5, 1), Game::makeCharacter(SOLDIER, POWERLIFTERS, 7, 3, 5, 3));
+    game.attack(GridPoint(0, 0), GridPoint(0, 3));
+    UnitStore units;
+    game.exportUnits(units);
+    ASSERT_EQ(4, units.getSize());
+    Game rebuilt(6, 6);
+    for (int unit_id = 0; unit_id < units.getSize(); unit_id++)
+    {
+        GridPoint coordinates = units.getUnitCoordinates(unit_id);
+        const Character* original = game.getCharacter(coordinates);
+        ASSERT_NE(nullptr, original);
+        std::shared_ptr<Character> character = units.makeCharacter(unit_id);
+        EXPECT_EQ(original->getCharacterType(), character->getCharacterType());
+        EXPECT_EQ(original->getCharacterTeam(), character->getCharacterTeam());
+        EXPECT_EQ(original->getCharacterHealthPoints(), character->getCharacterHealthPoints());
+        EXPECT_EQ(original->getCharacterAmmo(), character->getCharacterAmmo());
+        EXPECT_EQ(original->getCharacterRange(), character->getCharacterRange());
+        EXPECT_EQ(original->getCharacterPower(), character->getCharacterPower());
+        EXPECT_EQ(original->getSuccessfulStrikesCounter(), character->getSuccessfulStrikesCounter());
+        EXPECT_EQ(original->getCharacterIdentifierChar(), units.getUnit(unit_id).getCharacterIdentifierChar());
+        rebuilt.addCharacter(coordinates, character);
+    }
+    EXPECT_EQ(1, units.makeCharacter(0)->getSuccessfulStrikesCounter());
+    EXPECT_EQ(serialize(game), serialize(rebuilt));
+    EXPECT_EQ(game.getPositionHash(), rebuilt.getPositionHash());
+}
+
+TEST(UnitStoreTest, RemovingDeadUnitsKeepsTheOrderOfTheOthers) {
+    Game game = makeBoard(4, 9, 9);
+    UnitStore units;
+    game.exportUnits(units);
+    int num_of_units = units.getSize();
+    std::vector<units_t> damage_field(num_of_units);
+    std::vector<int> expected_ids;
+    int expected_deaths = 0;
+    for (int unit_id = 0; unit_id < num_of_units; unit_id++)
+    {
+        damage_field[unit_id] = (unit_id % 3 == 0) ? units.getUnit(unit_id).getCharacterHealthPoints() : unit_id % 2;
+        if (units.getUnit(unit_id).getCharacterHealthPoints() > damage_field[unit_id])
+        {
+            expected_ids.push_back(unit_id);
+        }
+        else
+        {
+            expected_deaths++;
+        }
+    }
+    UnitStore expected_units;
+    game.exportUnits(expected_units);
+    ASSERT_LT(0, expected_deaths);
+    EXPECT_EQ(expected_deaths, units.applyDamageField(damage_field));
+    EXPECT_EQ(expected_deaths, units.removeDeadUnits());
+    ASSERT_EQ(static_cast<int>(expected_ids.size()), units.getSize());
+    for (int unit_id = 0; unit_id < units.getSize(); unit_id++)
+    {
+        int old_id = expected_ids[unit_id];
+        EXPECT_TRUE(units.getUnitCoordinates(unit_id) == expected_units.getUnitCoordinates(old_id));
+        EXPECT_EQ(expected_units.getUnit(old_id).getCharacterHealthPoints() - damage_field[old_id],
+                  units.getUnit(unit_id).getCharacterHealthPoints());
+        EXPECT_EQ(expected_units.getUnit(old_id).getCharacterType(), units.getUnit(unit_id).getCharacterType());
+        EXPECT_EQ(expected_units.getUnit(old_id).getCharacterPower(), units.getUnit(unit_id).getCharacterPower());
+        EXPECT_EQ(unit_id, units.getUnit(unit_id).getUnitId());
+    }
+    EXPECT_EQ(0, units.removeDeadUnits());
+}
+
+TEST(UnitStoreTest, AreaDamageMatchesAScalarReference) {
+    Game game = makeBoard(7, 24, 17);
+    UnitStore units;
+    game.exportUnits(units);
+    std::vector<units_t> damage_field;
+    for (int center_row = -2; center_row < 26; center_row += 5)
+    {
+        for (int radius = 0; radius < 30; radius += 4)
+        {
+            for (int team = POWERLIFTERS; team <= CROSSFITTERS; team++)
+            {
+                GridPoint center(center_row, (center_row * 3) % 17);
+                units.computeAreaDamage(center, radius, static_cast<Team>(team), 3, damage_field);
+                ASSERT_EQ(static_cast<size_t>(units.getSize()), damage_field.size());
+                for (int unit_id = 0; unit_id < units.getSize(); unit_id++)
+                {
+                    GridPoint coordinates = units.getUnitCoordinates(unit_id);
+                    bool is_hit = std::abs(coordinates.row - center.row) + std::abs(coordinates.col - center.col) <=
+                                  radius && units.getUnit(unit_id).getCharacterTeam() != team;
+                    EXPECT_EQ(is_hit ? 3 : 0, damage_field[unit_id]);
+                }
+            }
+        }
+    }
+    damage_field.pop_back();
+    EXPECT_THROW(units.applyDamageField(damage_field), IllegalArgument);
+}
+
+TEST(UnitStoreTest, UnitsTakeLessMemoryThanCharacters) {
+    Game game = makeBoard(2, 64, 64);
+    UnitStore units;
+    game.exportUnits(units);
+    ASSERT_LT(0, units.getSize());
+    size_t bytes_per_unit = units.getMemoryUsage() / units.getSize();
+    size_t bytes_per_character = sizeof(Medic) + sizeof(std::shared_ptr<Character>);
+    EXPECT_LE(bytes_per_unit, 30u);
+    EXPECT_LT(2 * bytes_per_unit, bytes_per_character);
+    units.clear();
+    EXPECT_EQ(0, units.getSize());
+}
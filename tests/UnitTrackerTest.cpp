@@ -0,0 +1,61 @@
+#include "UnitTracker.h"
+#include "RandomPolicy.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+using namespace mtm;
+
+namespace
+{
+    std::vector<std::pair<int, int>> getSortedCells(const std::vector<GridPoint>& units) {
+        std::vector<std::pair<int, int>> cells;
+        for (const GridPoint& coordinates : units)
+        {
+            cells.push_back(std::make_pair(coordinates.row, coordinates.col));
+        }
+        std::sort(cells.begin(), cells.end());
+        return cells;
+    }
+
+    void expectSameUnits(const UnitTracker& tracker, const Game& game) {
+        UnitTracker exported;
+        exported.update(game);
+        EXPECT_EQ(getSortedCells(exported.getUnits(POWERLIFTERS)), getSortedCells(tracker.getUnits(POWERLIFTERS)));
+        EXPECT_EQ(getSortedCells(exported.getUnits(CROSSFITTERS)), getSortedCells(tracker.getUnits(CROSSFITTERS)));
+    }
+}
+
+TEST(UnitTrackerTest, FollowsTheChangesOfTheBoard) {
+    Game game(12, 12);
+    for (int i = 0; i < 12; i++)
+    {
+        game.addCharacter(GridPoint(i, i), Game::makeCharacter(SOLDIER, POWERLIFTERS, 3, 2, 5, 2));
+        game.addCharacter(GridPoint(i, 11 - i == i ? 0 : 11 - i),
+                          Game::makeCharacter(static_cast<CharacterType>(i % 3), CROSSFITTERS, 3, 2, 5, 2));
+    }
+    UnitTracker tracker;
+    RandomPolicy policies[2] = {RandomPolicy(1), RandomPolicy(2)};
+    for (int turn = 0; turn < 300 && !game.isOver(); turn++)
+    {
+        tracker.update(game);
+        expectSameUnits(tracker, game);
+        policies[turn % 2].playTurn(game, static_cast<Team>(turn % 2), turn);
+    }
+    tracker.update(game);
+    expectSameUnits(tracker, game);
+}
+
+TEST(UnitTrackerTest, ExportsTheBoardAgainAfterAnAssignment) {
+    Game game(4, 4);
+    game.addCharacter(GridPoint(0, 0), Game::makeCharacter(MEDIC, POWERLIFTERS, 3, 2, 5, 2));
+    UnitTracker tracker;
+    tracker.update(game);
+    Game other(5, 5);
+    other.addCharacter(GridPoint(4, 4), Game::makeCharacter(SNIPER, CROSSFITTERS, 3, 2, 5, 2));
+    game = other;
+    tracker.update(game);
+    EXPECT_TRUE(tracker.getUnits(POWERLIFTERS).empty());
+    ASSERT_EQ(1u, tracker.getUnits(CROSSFITTERS).size());
+    EXPECT_EQ(GridPoint(4, 4), tracker.getUnits(CROSSFITTERS)[0]);
+}
@@ -0,0 +1,5 @@
+#include "../Simulation.h"
+
+int main(int argc, char* argv[]) {
+    return mtm::Simulation::runCli(argc, argv, std::cout);
+}